@@ -0,0 +1,127 @@
+/**
+ * @file bench_parse_value.cpp
+ * @brief Per-value cost of internal::parse_value
+ *
+ * Compares the previous std::istringstream-based parser ("before") with the
+ * current std::from_chars / allocation-free implementation ("after").
+ *
+ * Build instructions:
+ *   g++ -std=c++17 -O2 benchmarks/bench_parse_value.cpp -I include -o bench_parse_value -pthread
+ */
+
+#define LIVETUNER_IMPLEMENTATION
+#include "../include/LiveTuner.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace {
+
+// The parser as it was before the from_chars fast path
+template<typename T>
+bool parse_value_stream(const std::string& str, T& value) {
+    std::istringstream iss(str);
+    T temp;
+    if (iss >> temp) {
+        std::string remaining;
+        iss >> remaining;
+        if (remaining.empty()) {
+            value = temp;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parse_bool_stream(const std::string& str, bool& value) {
+    std::string lower = str;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (lower == "true" || lower == "yes" || lower == "1" || lower == "on") {
+        value = true;
+        return true;
+    }
+    if (lower == "false" || lower == "no" || lower == "0" || lower == "off") {
+        value = false;
+        return true;
+    }
+    return false;
+}
+
+// Keeps results observable so the loops are not optimized away
+volatile double g_sink = 0.0;
+
+template<typename Fn>
+double measure_ns(const std::vector<std::string>& inputs, int rounds, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    double acc = 0.0;
+    for (int r = 0; r < rounds; ++r) {
+        for (const auto& in : inputs) {
+            acc += fn(in);
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    g_sink = acc;
+    auto total = static_cast<double>(inputs.size()) * rounds;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / total;
+}
+
+template<typename T>
+void run_case(const char* name, const std::vector<std::string>& inputs, int rounds) {
+    double before = measure_ns(inputs, rounds, [](const std::string& s) {
+        T v{};
+        parse_value_stream(s, v);
+        return static_cast<double>(v);
+    });
+    double after = measure_ns(inputs, rounds, [](const std::string& s) {
+        T v{};
+        livetuner::internal::parse_value(s, v);
+        return static_cast<double>(v);
+    });
+    std::cout << std::left << std::setw(10) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(1) << before
+              << std::setw(12) << after
+              << std::setw(10) << std::setprecision(2) << (before / after) << "x\n";
+}
+
+} // namespace
+
+int main() {
+    constexpr int rounds = 20000;
+
+    std::vector<std::string> ints = {"0", "42", "-17", "100000", "2147483647", "+8", "65535", "-1"};
+    std::vector<std::string> floats = {"0.5", "3.14159", "-2.75", "1e-3", "97", "100.5", "6.02e23", "-0.001"};
+    std::vector<std::string> bools = {"true", "false", "Yes", "no", "ON", "off", "1", "0"};
+
+    std::cout << "=== parse_value per-value cost (ns) ===\n";
+    std::cout << std::left << std::setw(10) << "type"
+              << std::right << std::setw(12) << "before" << std::setw(12) << "after"
+              << std::setw(11) << "speedup" << "\n";
+
+    run_case<int>("int", ints, rounds);
+    run_case<int64_t>("int64", ints, rounds);
+    run_case<float>("float", floats, rounds);
+    run_case<double>("double", floats, rounds);
+
+    double before = measure_ns(bools, rounds, [](const std::string& s) {
+        bool v = false;
+        parse_bool_stream(s, v);
+        return v ? 1.0 : 0.0;
+    });
+    double after = measure_ns(bools, rounds, [](const std::string& s) {
+        bool v = false;
+        livetuner::internal::parse_value(s, v);
+        return v ? 1.0 : 0.0;
+    });
+    std::cout << std::left << std::setw(10) << "bool"
+              << std::right << std::setw(12) << std::fixed << std::setprecision(1) << before
+              << std::setw(12) << after
+              << std::setw(10) << std::setprecision(2) << (before / after) << "x\n";
+
+#if !LIVETUNER_HAS_FLOAT_FROM_CHARS
+    std::cout << "\nNote: floating-point from_chars unavailable; float/double use the stream path.\n";
+#endif
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file bench_watcher_setup.cpp
+ * @brief Per-call cost of LiveTuner blocking reads (get_timeout / tune_timeout)
+ *
+ * Compares setting up and tearing down a file watcher on every call (how
+ * get_timeout() used to work) with the long-lived watcher that LiveTuner
+ * now starts on first use. The value is already in the file, so each call
+ * returns after its first read; what remains is the watcher overhead.
+ *
+ * Build instructions:
+ *   g++ -std=c++17 -O2 benchmarks/bench_watcher_setup.cpp -I include -o bench_watcher_setup -pthread
+ */
+
+#define LIVETUNER_IMPLEMENTATION
+#include "../include/LiveTuner.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+template<typename Fn>
+double measure_us(int iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        fn();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+void print_row(const char* name, double us) {
+    std::cout << std::left << std::setw(44) << name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(1) << us << "\n";
+}
+
+} // namespace
+
+int main() {
+    constexpr int iterations = 2000;
+    const auto path = (std::filesystem::temp_directory_path() / "livetuner_bench_setup.txt").string();
+    {
+        std::ofstream out(path);
+        out << "42\n";
+    }
+
+    std::cout << "=== Blocking read per-call cost (us) ===\n";
+
+    // Before: a watcher per call (start, first read, stop)
+    auto per_call = [&](bool own_instance) {
+        livetuner::LiveTuner tuner(path);
+        tuner.set_event_driven(false);  // Reads only; the watcher is set up by hand
+        livetuner::internal::FileWatcherConfig config;
+        config.external_loop = own_instance;
+        return measure_us(iterations, [&] {
+            livetuner::internal::FileWatcher watcher(config);
+            watcher.start(path, [] {});
+            int value = 0;
+            tuner.invalidate_cache();
+            tuner.try_get(value);
+            watcher.stop();
+        });
+    };
+    print_row("watcher per call (own inotify instance)", per_call(true));
+    print_row("watcher per call (shared reactor)", per_call(false));
+
+    // After: one watcher for the lifetime of the LiveTuner
+    livetuner::LiveTuner tuner(path);
+    int value = 0;
+    tuner.get_timeout(value, std::chrono::milliseconds(1000));  // Starts the watcher
+    print_row("persistent watcher (LiveTuner::get_timeout)", measure_us(iterations, [&] {
+        tuner.invalidate_cache();
+        tuner.get_timeout(value, std::chrono::milliseconds(1000));
+    }));
+
+    std::filesystem::remove(path);
+    return 0;
+}
@@ -67,6 +67,8 @@
 #include <optional>
 #include <any>
 #include <typeindex>
+#include <utility>
+#include <type_traits>
 #include <cmath>
 #include <algorithm>
 #include <cctype>
@@ -76,6 +78,8 @@
 #include <stdexcept>
 #include <cstdio>
 #include <cstdlib>
+#include <charconv>
+#include <cstring>
 // ============================================================
 // Configuration Macros
 // ============================================================
@@ -1131,15 +1135,6 @@ inline void log(LogLevel level, const std::string& message) {
 // Platform-specific RAII wrappers are defined in the implementation section
 // to avoid including Windows.h/inotify headers in user code.
 
-inline auto get_file_modify_time(const std::filesystem::path& path) 
-    -> std::filesystem::file_time_type {
-    std::error_code ec;
-    auto ftime = std::filesystem::last_write_time(path, ec);
-    if (ec) {
-        return std::filesystem::file_time_type::min();
-    }
-    return ftime;
-}
 struct FileReadRetryConfig {
     /// Number of retries (0 to disable)
     int max_retries = 3;
@@ -1149,6 +1144,11 @@ struct FileReadRetryConfig {
     
     /// Retry interval increase factor (1.0 for constant interval)
     double backoff_multiplier = 1.5;
+    
+    /// Deferred retries: a failed read returns immediately and the next
+    /// Params::update()/poll() or LiveTuner::try_get() after the retry delay
+    /// tries again, instead of sleeping on the calling thread
+    bool deferred = false;
 };
 
 /**
@@ -1163,6 +1163,136 @@ struct FileReadResult {
     }
 };
 
+/**
+ * @brief Reusable whole-file reader
+ * 
+ * Opens the file once, takes the size from the open handle (fstat) and
+ * fills a buffer that is kept across calls with positional reads, so a
+ * reload costs open + fstat + pread + close and no allocation once the
+ * buffer has grown to the file size.
+ * 
+ * Implemented in the LIVETUNER_IMPLEMENTATION section.
+ */
+class FileReader {
+public:
+    /**
+     * @brief Read the whole file (single attempt, no retries)
+     * @return true on success; view() then holds the contents
+     */
+    bool read(const std::filesystem::path& path, ErrorInfo& error);
+    
+    /**
+     * @brief Contents of the last successful read (valid until the next read)
+     */
+    std::string_view view() const { return std::string_view(buffer_.data(), size_); }
+    
+    /**
+     * @brief Move the contents out (the buffer starts over afterwards)
+     */
+    std::string take() {
+        buffer_.resize(size_);
+        size_ = 0;
+        return std::move(buffer_);
+    }
+
+private:
+    std::string buffer_;
+    size_t size_ = 0;
+};
+
+/**
+ * @brief Detects changes to a file through a descriptor kept open
+ * 
+ * Compares (dev, inode, size, mtime_ns, ctime_ns) from fstat() on the held
+ * descriptor instead of resolving the path on every check. The path is
+ * opened again only when the held file was removed or replaced (its link
+ * count drops to 0, or the path names another inode at the periodic path
+ * check, e.g. after a save that renamed the original to a backup).
+ * 
+ * Filesystem timestamps are coarser than the clock (a kernel tick on
+ * Linux, 2 s on FAT), so a second save in the same tick with the same size
+ * leaves the stamp unchanged. As in git's "racily clean" rule, a stamp
+ * younger than racy_window is not trusted: Changed is reported again (at
+ * most every racy_recheck_interval) until the stamp has aged.
+ * 
+ * Not thread-safe. Implemented in the LIVETUNER_IMPLEMENTATION section.
+ */
+class FileChangeDetector {
+public:
+    enum class Result {
+        Unchanged,
+        Changed,   ///< First check, stamp differs, or stamp still racy
+        Missing    ///< File cannot be opened
+    };
+    
+    static constexpr std::chrono::milliseconds racy_window{2000};
+    static constexpr std::chrono::milliseconds racy_recheck_interval{10};
+    static constexpr std::chrono::milliseconds path_check_interval{500};
+    
+    FileChangeDetector() = default;
+    ~FileChangeDetector() { close(); }
+    FileChangeDetector(const FileChangeDetector&) = delete;
+    FileChangeDetector& operator=(const FileChangeDetector&) = delete;
+    
+    FileChangeDetector(FileChangeDetector&& other) noexcept { *this = std::move(other); }
+    FileChangeDetector& operator=(FileChangeDetector&& other) noexcept {
+        if (this != &other) {
+            close();
+            path_ = std::move(other.path_);
+            handle_ = std::exchange(other.handle_, -1);
+            last_ = other.last_;
+            has_last_ = std::exchange(other.has_last_, false);
+            racy_ = other.racy_;
+            last_report_ = other.last_report_;
+            last_path_check_ = other.last_path_check_;
+        }
+        return *this;
+    }
+    
+    /**
+     * @brief Compare the file with the previous check
+     * 
+     * A different path than last time starts over (first check: Changed).
+     */
+    Result check(const std::filesystem::path& path);
+    
+    /**
+     * @brief Close the held file; the next check reports Changed
+     */
+    void reset() {
+        close();
+        has_last_ = false;
+    }
+
+private:
+    struct Stamp {
+        uint64_t dev = 0;
+        uint64_t ino = 0;
+        uint64_t size = 0;
+        uint64_t nlink = 0;
+        int64_t mtime_ns = 0;  // Since the Unix epoch
+        int64_t ctime_ns = 0;
+        
+        bool same_file_state(const Stamp& other) const {
+            return dev == other.dev && ino == other.ino && size == other.size &&
+                   mtime_ns == other.mtime_ns && ctime_ns == other.ctime_ns;
+        }
+    };
+    
+    bool open_held();
+    bool stat_held(Stamp& stamp) const;
+    bool path_names_held(const Stamp& stamp) const;
+    void close();
+    
+    std::filesystem::path path_;
+    intptr_t handle_ = -1;  // POSIX descriptor or Windows HANDLE; -1 when none is held
+    Stamp last_;
+    bool has_last_ = false;
+    bool racy_ = false;
+    std::chrono::steady_clock::time_point last_report_{};
+    std::chrono::steady_clock::time_point last_path_check_{};
+};
+
 /**
  * @brief Read file contents with retry logic
  * 
@@ -1172,17 +1302,18 @@ struct FileReadResult {
  * 
  * @param path File path
  * @param config Retry configuration
+ * @param reader Reader whose buffer receives the contents
  * @param error_out Error information output destination (optional)
- * @return Read file contents (empty optional on failure)
+ * @return true if reader.view() holds the file contents
  */
-inline std::optional<std::string> read_file_with_retry(
+inline bool read_file_with_retry(
     const std::filesystem::path& path,
-    const FileReadRetryConfig& config = FileReadRetryConfig{},
+    const FileReadRetryConfig& config,
+    FileReader& reader,
     ErrorInfo* error_out = nullptr) 
 {
     auto delay = config.retry_delay;
     ErrorInfo last_error;
-    std::string path_str = path.string();
     
     for (int attempt = 0; attempt <= config.max_retries; ++attempt) {
         if (attempt > 0) {
@@ -1191,88 +1322,17 @@ inline std::optional<std::string> read_file_with_retry(
                 static_cast<int>(delay.count() * config.backoff_multiplier));
         }
         
-        std::error_code ec;
-        
-        // Check if file exists
-        if (!std::filesystem::exists(path, ec)) {
-            last_error = ErrorInfo(ErrorType::FileNotFound, 
-                                  "File does not exist", path_str);
-            if (attempt == 0) {
-                log(LogLevel::Warning, last_error.to_string());
+        if (reader.read(path, last_error)) {
+            if (error_out) {
+                *error_out = ErrorInfo(); // No error
             }
-            continue;
-        }
-        if (ec) {
-            last_error = ErrorInfo(ErrorType::FileAccessDenied,
-                                  "Cannot access file: " + ec.message(), path_str);
-            if (attempt == 0) {
-                log(LogLevel::Warning, last_error.to_string());
-            }
-            continue;
-        }
-        
-        // Get file size (skip if 0 bytes)
-        auto file_size = std::filesystem::file_size(path, ec);
-        if (ec) {
-            last_error = ErrorInfo(ErrorType::FileReadError,
-                                  "Cannot get file size: " + ec.message(), path_str);
-            log(LogLevel::Debug, last_error.to_string());
-            continue;
-        }
-        if (file_size == 0) {
-            last_error = ErrorInfo(ErrorType::FileEmpty,
-                                  "File is empty", path_str);
-            log(LogLevel::Debug, last_error.to_string());
-            continue;
-        }
-        
-        // Open and read file
-        std::ifstream file(path, std::ios::binary);
-        if (!file) {
-            last_error = ErrorInfo(ErrorType::FileAccessDenied,
-                                  "Cannot open file for reading", path_str);
-            log(LogLevel::Debug, last_error.to_string());
-            continue;
-        }
-        
-        std::string content;
-        content.reserve(static_cast<size_t>(file_size));
-        
-        try {
-            content.assign(
-                std::istreambuf_iterator<char>(file),
-                std::istreambuf_iterator<char>());
-        } catch (const std::exception& e) {
-            last_error = ErrorInfo(ErrorType::FileReadError,
-                                  std::string("Exception during file read: ") + e.what(), path_str);
-            log(LogLevel::Debug, last_error.to_string());
-            continue;
-        } catch (...) {
-            last_error = ErrorInfo(ErrorType::FileReadError,
-                                  "Unknown exception during file read", path_str);
-            log(LogLevel::Debug, last_error.to_string());
-            continue;
+            return true;
         }
         
-        // Verify successful read and expected size
-        // (When writing, file size and actual read amount may differ)
-        if (file.good() || file.eof()) {
-            // Verify content is not empty
-            if (!content.empty()) {
-                if (error_out) {
-                    *error_out = ErrorInfo(); // No error
-                }
-                return content;
-            } else {
-                last_error = ErrorInfo(ErrorType::FileEmpty,
-                                      "File content is empty after read", path_str);
-                log(LogLevel::Debug, last_error.to_string());
-            }
-        } else {
-            last_error = ErrorInfo(ErrorType::FileReadError,
-                                  "File stream in bad state after read", path_str);
-            log(LogLevel::Debug, last_error.to_string());
-        }
+        const bool access_problem = last_error.type == ErrorType::FileNotFound ||
+                                    last_error.type == ErrorType::FileAccessDenied;
+        log(access_problem && attempt == 0 ? LogLevel::Warning : LogLevel::Debug,
+            last_error.to_string());
     }
     
     // All retries failed
@@ -1286,9 +1346,186 @@ inline std::optional<std::string> read_file_with_retry(
             last_error.to_string());
     }
     
-    return std::nullopt;
+    return false;
+}
+
+/**
+ * @brief Read file contents with retry logic (into a new string)
+ * 
+ * @param path File path
+ * @param config Retry configuration
+ * @param error_out Error information output destination (optional)
+ * @return Read file contents (empty optional on failure)
+ */
+inline std::optional<std::string> read_file_with_retry(
+    const std::filesystem::path& path,
+    const FileReadRetryConfig& config = FileReadRetryConfig{},
+    ErrorInfo* error_out = nullptr) 
+{
+    FileReader reader;
+    if (!read_file_with_retry(path, config, reader, error_out)) {
+        return std::nullopt;
+    }
+    return reader.take();
+}
+
+/**
+ * @brief 64-bit content hash (XXH64, seed 0)
+ * 
+ * Used to recognize rewrites with identical bytes. Not cryptographic.
+ */
+inline uint64_t hash_content(std::string_view data) {
+    constexpr uint64_t p1 = 11400714785074694791ULL;
+    constexpr uint64_t p2 = 14029467366897019727ULL;
+    constexpr uint64_t p3 = 1609587929392839161ULL;
+    constexpr uint64_t p4 = 9650029242287828579ULL;
+    constexpr uint64_t p5 = 2870177450012600261ULL;
+    
+    auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+    auto read64 = [](const char* p) { uint64_t v; std::memcpy(&v, p, 8); return v; };
+    auto read32 = [](const char* p) { uint32_t v; std::memcpy(&v, p, 4); return v; };
+    auto round = [&](uint64_t acc, uint64_t input) {
+        acc += input * p2;
+        return rotl(acc, 31) * p1;
+    };
+    auto merge = [&](uint64_t acc, uint64_t val) {
+        acc ^= round(0, val);
+        return acc * p1 + p4;
+    };
+    
+    const char* p = data.data();
+    const char* const end = p + data.size();
+    uint64_t h;
+    
+    if (data.size() >= 32) {
+        uint64_t v1 = p1 + p2, v2 = p2, v3 = 0, v4 = 0 - p1;
+        for (; p + 32 <= end; p += 32) {
+            v1 = round(v1, read64(p));
+            v2 = round(v2, read64(p + 8));
+            v3 = round(v3, read64(p + 16));
+            v4 = round(v4, read64(p + 24));
+        }
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = merge(h, v1);
+        h = merge(h, v2);
+        h = merge(h, v3);
+        h = merge(h, v4);
+    } else {
+        h = p5;
+    }
+    
+    h += static_cast<uint64_t>(data.size());
+    for (; p + 8 <= end; p += 8) {
+        h ^= round(0, read64(p));
+        h = rotl(h, 27) * p1 + p4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * p1;
+        h = rotl(h, 23) * p2 + p3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= static_cast<uint64_t>(static_cast<unsigned char>(*p)) * p5;
+        h = rotl(h, 11) * p1;
+    }
+    
+    h ^= h >> 33;
+    h *= p2;
+    h ^= h >> 29;
+    h *= p3;
+    h ^= h >> 32;
+    return h;
+}
+
+/**
+ * @brief Retry schedule for deferred reads (FileReadRetryConfig::deferred)
+ */
+struct DeferredRetry {
+    int failures = 0;  ///< Failed attempts in the current round (0 = none pending)
+    std::chrono::milliseconds delay{0};
+    std::chrono::steady_clock::time_point next_attempt{};
+    
+    bool pending() const { return failures > 0; }
+    
+    /// True while a retry is scheduled but its deadline has not passed yet
+    bool waiting(std::chrono::steady_clock::time_point now) const {
+        return failures > 0 && now < next_attempt;
+    }
+    
+    /**
+     * @brief Record a failed attempt and schedule the next one
+     * @return false once the configured retries are used up (the round ends)
+     */
+    bool fail(const FileReadRetryConfig& config, std::chrono::steady_clock::time_point now) {
+        delay = failures == 0
+            ? config.retry_delay
+            : std::chrono::milliseconds(static_cast<int>(delay.count() * config.backoff_multiplier));
+        next_attempt = now + delay;
+        if (++failures > config.max_retries) {
+            failures = 0;
+            return false;
+        }
+        return true;
+    }
+    
+    void reset() { failures = 0; }
+};
+
+/**
+ * @brief Read file contents once, scheduling a retry on failure (never sleeps)
+ * 
+ * @param path File path
+ * @param config Retry configuration
+ * @param reader Reader whose buffer receives the contents
+ * @param retry Retry schedule, updated on success and failure
+ * @param error_out Error information output destination (optional)
+ * @return true if reader.view() holds the file contents
+ */
+inline bool try_read_file(
+    const std::filesystem::path& path,
+    const FileReadRetryConfig& config,
+    FileReader& reader,
+    DeferredRetry& retry,
+    ErrorInfo* error_out = nullptr)
+{
+    ErrorInfo error;
+    if (reader.read(path, error)) {
+        retry.reset();
+        if (error_out) {
+            *error_out = ErrorInfo(); // No error
+        }
+        return true;
+    }
+    
+    const int attempt = retry.failures;
+    if (retry.fail(config, std::chrono::steady_clock::now())) {
+        const bool access_problem = error.type == ErrorType::FileNotFound ||
+                                    error.type == ErrorType::FileAccessDenied;
+        log(access_problem && attempt == 0 ? LogLevel::Warning : LogLevel::Debug,
+            error.to_string() + " (retry in " + std::to_string(retry.delay.count()) + "ms)");
+    } else {
+        log(LogLevel::Error, "Failed to read file after " + 
+            std::to_string(attempt + 1) + " attempts: " + error.to_string());
+    }
+    
+    if (error_out) {
+        *error_out = error;
+    }
+    return false;
 }
 
+/**
+ * @brief When a file watcher reports a change
+ */
+enum class TriggerPolicy {
+    /// Once the writer is done: close after writing, rename into place, or
+    /// size and modification time stable for settle_interval (writers that
+    /// keep the file open). Windows: the file can be opened deny-write.
+    WriteComplete,
+    /// On every write event (may observe partially written files)
+    AnyWrite
+};
+
 /**
  * @brief File watcher configuration
  */
@@ -1307,8 +1544,42 @@ struct FileWatcherConfig {
     
     /// Callback on buffer overflow (optional)
     /// Arguments: current buffer size, new buffer size (0 if maximum reached)
+    /// On Linux it reports an inotify queue overflow or a watch dropped by the
+    /// kernel (both arguments 0); the file is then resynced by stat and
+    /// reported as changed if it differs.
+    /// Like the change callback, it runs on the watcher thread, which on
+    /// Linux and in polling mode is shared by every watcher: keep it short.
+    /// It runs without the shared lock, so stopping other watchers from it
+    /// (or while it blocks) is fine; stopping this watcher from another
+    /// thread waits for it to return.
     std::function<void(size_t current_size, size_t new_size)> on_buffer_overflow;
     
+    /// Quiescence window for change events (0 = report every event batch at once)
+    /// A burst of events (e.g. MODIFY x N then CLOSE_WRITE, or CREATE + MOVED_TO
+    /// for an atomic-rename save) is reported once, after no further event
+    /// arrived for this long. On macOS this is the FSEvents latency.
+    std::chrono::milliseconds debounce{0};
+    
+    /// When to report a change (see TriggerPolicy)
+    TriggerPolicy trigger = TriggerPolicy::WriteComplete;
+    
+    /// Stability check interval for TriggerPolicy::WriteComplete when no
+    /// completion event is available (writes without close, polling, Windows)
+    std::chrono::milliseconds settle_interval{50};
+    
+    /// Thread-less mode: the watcher starts no thread and does not use the
+    /// shared reactor; the host polls FileWatcher::event_fd() in its own
+    /// event loop and calls process_events() (Linux only; elsewhere the
+    /// watcher runs its usual thread and event_fd() returns -1)
+    bool external_loop = false;
+    
+    /// Follow the symlink chain of the watched path (Linux only)
+    /// For paths such as `params.json -> ..data/params.json` whose `..data`
+    /// link is swapped atomically (Kubernetes ConfigMap volumes). Every link
+    /// in the chain is watched; a swap moves the watch to the new target and
+    /// is reported as one change.
+    bool follow_symlinks = false;
+    
     /// Minimum buffer size
     static constexpr size_t min_buffer_size = 4096;
     
@@ -1366,8 +1637,27 @@ public:
      */
     void stop();
 
+    /**
+     * @brief Number of changes reported since construction (monotonic)
+     */
+    uint64_t change_generation() const { return change_generation_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Wait until the change generation moves past `last_seen`
+     * 
+     * Each waiter keeps its own `last_seen`, so any number of threads
+     * observe every change. Start from change_generation().
+     * 
+     * @return true (and updates last_seen) if a change was reported;
+     *         false on timeout or when the watcher stops
+     */
+    bool wait_for_change(uint64_t& last_seen, std::chrono::milliseconds timeout);
+
     /**
      * @brief Wait for file change (with timeout)
+     * 
+     * Consumes changes on behalf of all callers of this overload: with
+     * several waiters, use wait_for_change(last_seen, timeout) instead.
      */
     bool wait_for_change(std::chrono::milliseconds timeout);
 
@@ -1378,6 +1668,46 @@ public:
 
     bool is_running() const;
 
+    /**
+     * @brief Event queue overflows seen by this watcher
+     * 
+     * Windows: change buffer overflows. Linux: inotify queue overflows
+     * (events were lost; the file was resynced by stat).
+     */
+    uint64_t overflow_count() const { return overflow_count_.load(); }
+
+    /**
+     * @brief Watches the kernel dropped and that were re-armed (Linux)
+     * 
+     * The watched directory was removed, renamed over or unmounted.
+     */
+    uint64_t invalidation_count() const { return invalidation_count_.load(); }
+
+    /**
+     * @brief Pollable descriptor in thread-less mode (FileWatcherConfig::external_loop)
+     * 
+     * Becomes readable when events are queued. -1 when the watcher runs its
+     * own thread (not in thread-less mode, not on Linux, or polling fallback).
+     */
+    int event_fd() const;
+
+    /**
+     * @brief Handle queued events and due timers inline (thread-less mode)
+     * 
+     * Call when event_fd() is readable or next_timeout() has elapsed.
+     * The change callback runs on the calling thread.
+     * 
+     * @return true if a change was reported
+     */
+    bool process_events();
+
+    /**
+     * @brief Milliseconds until process_events() has timer work (-1 if none)
+     * 
+     * For the host's poll/epoll_wait timeout (debounce and settle checks).
+     */
+    int next_timeout() const;
+
     static bool has_native_support();
 
     // Accessors for native callbacks (internal use only)
@@ -1391,7 +1721,10 @@ private:
     std::filesystem::path file_path_;
     ChangeCallback callback_;
     std::atomic<bool> running_{false};
-    std::atomic<bool> change_detected_{false};
+    std::atomic<uint64_t> change_generation_{0};  // Bumped under cv_mtx_
+    std::atomic<uint64_t> overflow_count_{0};
+    std::atomic<uint64_t> invalidation_count_{0};
+    uint64_t consumed_generation_ = 0;             // Legacy wait_for_change() (under cv_mtx_)
     std::thread watcher_thread_;
     std::mutex cv_mtx_;
     std::condition_variable cv_;
@@ -1400,7 +1733,7 @@ private:
     bool start_native();
     void stop_native();
     bool start_polling();
-    void watch_polling();
+    void stop_polling();
     void notify_change();
 };
 
@@ -1449,38 +1782,123 @@ inline std::string trim(const std::string& str) {
     return str.substr(start, end - start + 1);
 }
 
+/**
+ * @brief Trim string view (no allocation)
+ */
+inline std::string_view trim_view(std::string_view str) {
+    size_t start = str.find_first_not_of(" \t\r\n");
+    if (start == std::string_view::npos) return std::string_view();
+    size_t end = str.find_last_not_of(" \t\r\n");
+    return str.substr(start, end - start + 1);
+}
+
+template<typename T>
+struct is_char_type : std::bool_constant<
+    std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+    std::is_same_v<T, unsigned char> || std::is_same_v<T, wchar_t> ||
+    std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>> {};
+
+/**
+ * @brief Floating-point std::from_chars is available (libstdc++ 11+, MSVC 19.24+)
+ */
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define LIVETUNER_HAS_FLOAT_FROM_CHARS 1
+#else
+#define LIVETUNER_HAS_FLOAT_FROM_CHARS 0
+#endif
+
+/**
+ * @brief Parse a number with std::from_chars (locale-independent, no allocation)
+ * 
+ * Accepts the same input as the stream parser: surrounding whitespace and
+ * a leading '+' are allowed, anything else left over is an error.
+ */
+template<typename T>
+inline bool parse_number(std::string_view str, T& value) {
+    constexpr std::string_view whitespace = " \t\r\n\v\f";
+    size_t start = str.find_first_not_of(whitespace);
+    if (start == std::string_view::npos) return false;
+    str = str.substr(start, str.find_last_not_of(whitespace) - start + 1);
+    
+    if (str.size() > 1 && str.front() == '+' && str[1] != '-') {
+        str.remove_prefix(1);
+    }
+    
+    const char* first = str.data();
+    const char* last = str.data() + str.size();
+    T temp{};
+    std::from_chars_result result;
+    if constexpr (std::is_floating_point_v<T>) {
+        // Stream parsing never accepted inf/nan; keep it that way
+        char c = static_cast<char>(std::tolower(static_cast<unsigned char>(
+            str.front() == '-' && str.size() > 1 ? str[1] : str.front())));
+        if (c == 'i' || c == 'n') return false;
+        result = std::from_chars(first, last, temp, std::chars_format::general);
+    } else {
+        result = std::from_chars(first, last, temp);
+    }
+    if (result.ec != std::errc() || result.ptr != last) {
+        return false;
+    }
+    value = temp;
+    return true;
+}
+
 /**
  * @brief Parse value from string
+ * 
+ * Integers (and floating-point types where supported) use std::from_chars;
+ * other types go through operator>>.
  */
 template<typename T>
 inline bool parse_value(const std::string& str, T& value) {
-    std::istringstream iss(str);
-    T temp;
-    if (iss >> temp) {
-        // Check if stream was fully consumed (no extra characters)
-        std::string remaining;
-        iss >> remaining;
-        if (remaining.empty()) {
-            value = temp;
-            return true;
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> && !is_char_type<T>::value) {
+        return parse_number(str, value);
+    } else if constexpr (std::is_floating_point_v<T> && LIVETUNER_HAS_FLOAT_FROM_CHARS) {
+        return parse_number(str, value);
+    } else {
+        std::istringstream iss(str);
+        T temp;
+        if (iss >> temp) {
+            // Check if stream was fully consumed (no extra characters)
+            std::string remaining;
+            iss >> remaining;
+            if (remaining.empty()) {
+                value = temp;
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+/**
+ * @brief Case-insensitive comparison against a lowercase literal
+ */
+inline bool equals_lower(std::string_view str, std::string_view lower_literal) {
+    if (str.size() != lower_literal.size()) return false;
+    for (size_t i = 0; i < str.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(str[i])) != lower_literal[i]) {
+            return false;
         }
     }
-    return false;
+    return true;
 }
 
 // Specialization for bool type
 template<>
 inline bool parse_value<bool>(const std::string& str, bool& value) {
-    std::string lower = str;
-    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-    
-    if (lower == "true" || lower == "yes" || lower == "1" || lower == "on") {
-        value = true;
-        return true;
+    for (std::string_view word : {"true", "yes", "1", "on"}) {
+        if (equals_lower(str, word)) {
+            value = true;
+            return true;
+        }
     }
-    if (lower == "false" || lower == "no" || lower == "0" || lower == "off") {
-        value = false;
-        return true;
+    for (std::string_view word : {"false", "no", "0", "off"}) {
+        if (equals_lower(str, word)) {
+            value = false;
+            return true;
+        }
     }
     return false;
 }
@@ -1500,24 +1918,115 @@ inline bool parse_value<std::string>(const std::string& str, std::string& value)
 }
 
 /**
- * @brief JSON parser using picojson
- * 
- * picojson by Kazuho Oku and Cybozu Labs, Inc. (BSD 2-Clause License)
- * Extracts values from JSON objects, including nested structures
- * Nested keys are flattened using dot notation (e.g., "parent.child.value")
+ * @brief Parameter value converted once at load time
+ *
+ * Keeps the raw text plus every typed interpretation that succeeded, so
+ * reads become a tag check and a copy instead of a stream parse.
+ * Types without a typed slot fall back to parse_value() on the text.
  */
-class PicojsonParser {
-public:
-    using ValueMap = std::unordered_map<std::string, std::string>;
-    
-    static bool parse(const std::string& content, ValueMap& result) {
-        result.clear();
-        
-        picojson::value v;
-        std::string err = picojson::parse(v, content);
-        
-        if (!err.empty() || !v.is<picojson::object>()) {
-            return false;
+struct ParamValue {
+    enum Kind : uint8_t {
+        KindInt    = 1 << 0,   ///< int_value is valid (fits int64_t)
+        KindDouble = 1 << 1,   ///< double_value is valid
+        KindFloat  = 1 << 2,   ///< float_value is valid (parsed as float, not narrowed)
+        KindBool   = 1 << 3,   ///< bool_value is valid
+        KindQuoted = 1 << 4    ///< text is wrapped in quotes
+    };
+
+    std::string text;
+    int64_t int_value = 0;
+    double double_value = 0.0;
+    float float_value = 0.0f;
+    bool bool_value = false;
+    uint8_t kinds = 0;
+
+    ParamValue() = default;
+
+    explicit ParamValue(std::string raw) : text(std::move(raw)) {
+        if (parse_value(text, int_value)) kinds |= KindInt;
+        if (parse_value(text, double_value)) kinds |= KindDouble;
+        if (parse_value(text, float_value)) kinds |= KindFloat;
+        if (parse_value(text, bool_value)) kinds |= KindBool;
+        if (text.size() >= 2 &&
+            ((text.front() == '"' && text.back() == '"') ||
+             (text.front() == '\'' && text.back() == '\''))) {
+            kinds |= KindQuoted;
+        }
+    }
+
+    bool has(Kind kind) const { return (kinds & kind) != 0; }
+};
+
+/**
+ * @brief Read a typed value from a pre-converted ParamValue
+ */
+template<typename T>
+inline bool convert_value(const ParamValue& source, T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        if (!source.has(ParamValue::KindBool)) return false;
+        value = source.bool_value;
+        return true;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        if (source.has(ParamValue::KindQuoted)) {
+            value.assign(source.text, 1, source.text.size() - 2);
+        } else {
+            value = source.text;
+        }
+        return true;
+    } else if constexpr (std::is_integral_v<T> && !is_char_type<T>::value) {
+        if (!source.has(ParamValue::KindInt)) {
+            if constexpr (std::is_unsigned_v<T>) {
+                return parse_value(source.text, value);  // Above INT64_MAX
+            }
+            return false;
+        }
+        const int64_t v = source.int_value;
+        if constexpr (std::is_signed_v<T>) {
+            if (v < static_cast<int64_t>(std::numeric_limits<T>::min()) ||
+                v > static_cast<int64_t>(std::numeric_limits<T>::max())) {
+                return false;
+            }
+        } else {
+            if (v < 0 || static_cast<uint64_t>(v) > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+                return false;
+            }
+        }
+        value = static_cast<T>(v);
+        return true;
+    } else if constexpr (std::is_same_v<T, float>) {
+        if (!source.has(ParamValue::KindFloat)) return false;
+        value = source.float_value;
+        return true;
+    } else if constexpr (std::is_same_v<T, double>) {
+        if (!source.has(ParamValue::KindDouble)) return false;
+        value = source.double_value;
+        return true;
+    } else {
+        return parse_value(source.text, value);
+    }
+}
+
+/**
+ * @brief JSON parser using picojson
+ * 
+ * picojson by Kazuho Oku and Cybozu Labs, Inc. (BSD 2-Clause License)
+ * Extracts values from JSON objects, including nested structures
+ * Nested keys are flattened using dot notation (e.g., "parent.child.value")
+ */
+class PicojsonParser {
+public:
+    using ValueMap = std::unordered_map<std::string, std::string>;
+    
+    static bool parse(std::string_view content, ValueMap& result) {
+        result.clear();
+        
+        picojson::value v;
+        std::string err;
+        const char* first = content.data();
+        picojson::parse(v, first, first + content.size(), &err);
+        
+        if (!err.empty() || !v.is<picojson::object>()) {
+            return false;
         }
         
         const picojson::object& obj = v.get<picojson::object>();
@@ -1633,14 +2142,13 @@ class SimpleKeyValueParser {
 public:
     using ValueMap = std::unordered_map<std::string, std::string>;
     
-    static bool parse(const std::string& content, ValueMap& result, bool yaml_style = false) {
+    static bool parse(std::string_view content, ValueMap& result, bool yaml_style = false) {
         result.clear();
         
-        std::istringstream stream(content);
-        std::string line;
-        
-        while (std::getline(stream, line)) {
-            line = trim(line);
+        while (!content.empty()) {
+            size_t eol = content.find('\n');
+            std::string_view line = trim_view(content.substr(0, eol));
+            content.remove_prefix(eol == std::string_view::npos ? content.size() : eol + 1);
             
             // Skip comments and empty lines
             if (line.empty() || line[0] == '#' || line[0] == ';') continue;
@@ -1652,21 +2160,21 @@ public:
             if (line.front() == '[' && line.back() == ']') continue;
             
             // Parse key: value or key=value
-            size_t sep_pos = std::string::npos;
+            size_t sep_pos = std::string_view::npos;
             
             if (yaml_style) {
                 sep_pos = line.find(':');
             } else {
                 // INI format: prioritize =, otherwise look for :
                 sep_pos = line.find('=');
-                if (sep_pos == std::string::npos) {
+                if (sep_pos == std::string_view::npos) {
                     sep_pos = line.find(':');
                 }
             }
             
-            if (sep_pos != std::string::npos) {
-                std::string key = trim(line.substr(0, sep_pos));
-                std::string value = trim(line.substr(sep_pos + 1));
+            if (sep_pos != std::string_view::npos) {
+                std::string_view key = trim_view(line.substr(0, sep_pos));
+                std::string_view value = trim_view(line.substr(sep_pos + 1));
                 
                 // Remove quotes
                 if (value.size() >= 2) {
@@ -1677,7 +2185,7 @@ public:
                 }
                 
                 if (!key.empty()) {
-                    result[key] = value;
+                    result[std::string(key)] = std::string(value);
                 }
             }
         }
@@ -1686,621 +2194,885 @@ public:
     }
 };
 
-} // namespace internal
-
-// ============================================================
-// FileWatcherConfig Export
-// ============================================================
-
-/**
- * @brief File watcher configuration
- * 
- * Configure buffer size and overflow handling for file watching.
- * @see Params::set_watcher_config()
- */
-using FileWatcherConfig = internal::FileWatcherConfig;
-
-/**
- * @brief File read retry configuration
- * 
- * Prevents read errors while editor is writing (especially on Windows).
- * @see Params::set_read_retry_config()
- */
-using FileReadRetryConfig = internal::FileReadRetryConfig;
-
 // ============================================================
-// Params Class (Named Parameters)
+// Snapshot Publication (Lock-free Reads)
 // ============================================================
 
 /**
- * @brief Named parameter management
- * 
- * Binds multiple variables to a file and updates in batch.
- * 
- * @note Thread Safety: Callbacks run on the thread calling update() (main thread).
- * Safe for OpenGL/DirectX. Differs from LiveTuner's background thread callbacks.
+ * @brief Reader registration for single-writer epoch reclamation
+ *
+ * Readers enter under the current epoch parity and leave when done;
+ * synchronize() returns once every reader that entered before it was
+ * called has left (two-phase epoch flip, as in userspace RCU).
  */
-class Params {
+class EpochGate {
 public:
-    struct FileCache {
-        std::filesystem::file_time_type last_modify_time;
-        std::chrono::steady_clock::time_point last_access;
-        bool file_exists = false;
-        static constexpr std::chrono::milliseconds cache_duration{10};
-    };
-
-private:
-    // Base class for holding binding information
-    struct BindingBase {
-        virtual ~BindingBase() = default;
-        virtual bool update(const std::string& str_value) = 0;
-        virtual void apply_default() = 0;
-    };
-    
-    template<typename T>
-    struct Binding : public BindingBase {
-        T* target;
-        T default_value;
-        
-        Binding(T* t, T def) : target(t), default_value(def) {}
-        
-        bool update(const std::string& str_value) override {
-            return internal::parse_value(str_value, *target);
-        }
-        
-        void apply_default() override {
-            *target = default_value;
-        }
-    };
-
-    mutable std::mutex mtx_;
-    std::string file_path_;
-    FileFormat format_ = FileFormat::Auto;
-    FileCache file_cache_{
-        std::filesystem::file_time_type::min(),
-        std::chrono::steady_clock::time_point{},
-        false
-    };
-    
-    std::unordered_map<std::string, std::unique_ptr<BindingBase>> bindings_;
-    std::unordered_map<std::string, std::string> current_values_;
-    
-    std::unique_ptr<internal::FileWatcher> file_watcher_;
-    internal::FileWatcherConfig file_watcher_config_;
-    internal::FileReadRetryConfig file_read_retry_config_;
-    bool use_event_driven_ = true;
-    std::atomic<bool> file_changed_{false};
-    
-    // Error information
-    ErrorInfo last_error_;
+    EpochGate() {
+        readers_[0].store(0);
+        readers_[1].store(0);
+    }
     
-    // Callback
-    std::function<void()> on_change_callback_;
+    EpochGate(const EpochGate&) = delete;
+    EpochGate& operator=(const EpochGate&) = delete;
     
-    // Reentrancy prevention flag (whether callback is executing)
-    std::atomic<bool> in_callback_{false};
-
-public:
-    /**
-     * @brief Constructor
-     * @param file_path Path to configuration file
-     * @param format File format (default: auto-detect)
-     */
-    explicit Params(std::string_view file_path = "params.json", 
-                   FileFormat format = FileFormat::Auto)
-        : file_path_(file_path)
-        , format_(format) 
-    {
-        if (format_ == FileFormat::Auto) {
-            format_ = internal::detect_format(file_path_);
-        }
+    /// Register a reader; pass the result to leave()
+    std::atomic<uint32_t>* enter() const noexcept {
+        uint32_t epoch = epoch_.load();
+        auto& readers = readers_[epoch & 1u];
+        readers.fetch_add(1);
+        return &readers;
     }
     
-    /**
-     * @brief Get file read retry configuration
-     */
-    internal::FileReadRetryConfig get_read_retry_config() const {
-        std::lock_guard<std::mutex> lock(mtx_);
-        return file_read_retry_config_;
+    static void leave(std::atomic<uint32_t>* readers) noexcept {
+        readers->fetch_sub(1, std::memory_order_release);
     }
     
-    /**
-     * @brief Set file read retry configuration
-     * 
-     * Avoids conflicts while editor is writing (especially on Windows).
-     */
-    void set_read_retry_config(const internal::FileReadRetryConfig& config) {
-        std::lock_guard<std::mutex> lock(mtx_);
-        file_read_retry_config_ = config;
+    void synchronize() {
+        // Two flips: a reader may have registered under either parity
+        // before the caller's update, and each flip lets that parity drain
+        // while new readers move to the other one.
+        for (int phase = 0; phase < 2; ++phase) {
+            uint32_t epoch = epoch_.fetch_add(1);
+            auto& readers = readers_[epoch & 1u];
+            while (readers.load() != 0) {
+                std::this_thread::yield();
+            }
+        }
     }
-    
-    ~Params();
-    
-    Params(const Params&) = delete;
-    Params& operator=(const Params&) = delete;
-    Params(Params&&) noexcept;
-    Params& operator=(Params&&) noexcept;
 
+private:
+    std::atomic<uint32_t> epoch_{0};
+    mutable std::atomic<uint32_t> readers_[2];
+};
+
+/**
+ * @brief Single-writer publication cell with wait-free readers
+ *
+ * Holds an immutable object that is replaced as a whole with one atomic
+ * pointer swap. Readers pin the current object with read() and never block;
+ * the writer reclaims the previous object once every reader that could still
+ * see it has left (two-phase epoch flip, as in userspace RCU).
+ *
+ * Writers must be serialized externally (Params uses its own mutex).
+ * Keep ReadGuard lifetimes short: publish() waits for pinned readers.
+ */
+template<typename T>
+class SnapshotCell {
+public:
     /**
-     * @brief Get file watcher configuration
+     * @brief Pins a published object for the lifetime of the guard
      */
-    internal::FileWatcherConfig get_watcher_config() const {
-        std::lock_guard<std::mutex> lock(mtx_);
-        return file_watcher_config_;
+    class ReadGuard {
+    public:
+        ReadGuard(ReadGuard&& other) noexcept
+            : readers_(other.readers_), snapshot_(other.snapshot_) {
+            other.readers_ = nullptr;
+            other.snapshot_ = nullptr;
+        }
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        ReadGuard& operator=(ReadGuard&&) = delete;
+
+        ~ReadGuard() {
+            if (readers_) {
+                EpochGate::leave(readers_);
+            }
+        }
+
+        const T* get() const noexcept { return snapshot_; }
+        const T* operator->() const noexcept { return snapshot_; }
+        const T& operator*() const noexcept { return *snapshot_; }
+        explicit operator bool() const noexcept { return snapshot_ != nullptr; }
+
+    private:
+        friend class SnapshotCell;
+        ReadGuard(std::atomic<uint32_t>* readers, const T* snapshot) noexcept
+            : readers_(readers), snapshot_(snapshot) {}
+
+        std::atomic<uint32_t>* readers_;
+        const T* snapshot_;
+    };
+
+    SnapshotCell() = default;
+
+    explicit SnapshotCell(std::unique_ptr<const T> initial) {
+        current_.store(initial.release());
     }
-    
-    /**
-     * @brief Set file watcher configuration
-     * 
-     * Changes take effect on next start_watching() call.
-     */
-    void set_watcher_config(const internal::FileWatcherConfig& config) {
-        std::lock_guard<std::mutex> lock(mtx_);
-        file_watcher_config_ = config;
-        file_watcher_config_.validate();
+
+    ~SnapshotCell() {
+        delete current_.load();
     }
 
+    SnapshotCell(const SnapshotCell&) = delete;
+    SnapshotCell& operator=(const SnapshotCell&) = delete;
+
     /**
-     * @brief Bind variable to parameter
+     * @brief Pin the current object (wait-free, never takes a lock)
      */
-    template<typename T>
-    void bind(const std::string& name, T& variable, T default_value = T{}) {
-        std::lock_guard<std::mutex> lock(mtx_);
-        bindings_[name] = std::make_unique<Binding<T>>(&variable, default_value);
-        variable = default_value;
+    ReadGuard read() const noexcept {
+        auto* readers = gate_.enter();
+        return ReadGuard(readers, current_.load());
     }
 
     /**
-     * @brief Unbind parameter
+     * @brief Publish a new object and reclaim the previous one
+     *
+     * Blocks the (single) writer until readers of the old object are gone.
      */
-    void unbind(const std::string& name) {
-        std::lock_guard<std::mutex> lock(mtx_);
-        bindings_.erase(name);
+    void publish(std::unique_ptr<const T> next) {
+        const T* old = current_.exchange(next.release());
+        if (old) {
+            gate_.synchronize();
+            delete old;
+        }
     }
 
     /**
-     * @brief Unbind all parameters
+     * @brief Take the current object out of the cell
+     *
+     * Only valid while no readers can be active (construction, moves).
      */
-    void unbind_all() {
-        // Skip processing during callback execution (prevent reentrancy)
-        if (in_callback_.load()) {
-            internal::log(LogLevel::Warning, 
-                "unbind_all() called during callback execution - operation skipped");
-            return;
-        }
-        
-        std::lock_guard<std::mutex> lock(mtx_);
-        bindings_.clear();
+    std::unique_ptr<const T> release() noexcept {
+        return std::unique_ptr<const T>(current_.exchange(nullptr));
     }
 
+private:
+    std::atomic<const T*> current_{nullptr};
+    EpochGate gate_;
+};
+
+/**
+ * @brief Frame boundary shared by double-buffered bindings (Buffered<T>)
+ *
+ * Every Buffered<T> holds a front and a back copy; the domain's front index
+ * says which is current. The writer stages into the back copies and flip()
+ * swaps the index for all of them at once, then waits for readers still on
+ * the old front before that copy is written again. Readers pin a Frame and
+ * never block.
+ */
+class CommitDomain {
+public:
     /**
-     * @brief Read file and update bound variables (non-blocking)
-     * 
-     * @return true if values were updated
-     * 
-     * @note Thread Safety:
-     * This method should be called from your main thread (e.g., in the game loop).
-     * Any registered callback via on_change() will be executed synchronously on
-     * the SAME THREAD that calls this method, ensuring safe access to
-     * main-thread-only resources like OpenGL/DirectX contexts.
+     * @brief Pins the current front index for the lifetime of the frame
      */
-    bool update() {
-        // Prevent reentrancy during callback execution
-        if (in_callback_.load()) {
-            internal::log(LogLevel::Debug, 
-                "update() called during callback execution - skipped to prevent recursion");
-            return false;
+    class Frame {
+    public:
+        Frame(Frame&& other) noexcept : readers_(other.readers_), index_(other.index_) {
+            other.readers_ = nullptr;
         }
+        Frame(const Frame&) = delete;
+        Frame& operator=(const Frame&) = delete;
+        Frame& operator=(Frame&&) = delete;
         
-        bool updated = false;
-        std::function<void()> callback_to_invoke;
-        
-        {
-            std::lock_guard<std::mutex> lock(mtx_);
-            
-            ensure_file_exists();
-            
-            auto now = std::chrono::steady_clock::now();
-            auto current_modify_time = internal::get_file_modify_time(file_path_);
-            
-            // Cache check
-            if (file_cache_.file_exists && 
-                (now - file_cache_.last_access) < FileCache::cache_duration &&
-                current_modify_time == file_cache_.last_modify_time) {
-                return false;
-            }
-            
-            updated = load_file();
-            
-            file_cache_.last_modify_time = current_modify_time;
-            file_cache_.last_access = now;
-            file_cache_.file_exists = true;
-            
-            // Copy callback and invoke outside lock (prevent deadlock)
-            if (updated && on_change_callback_) {
-                callback_to_invoke = on_change_callback_;
+        ~Frame() {
+            if (readers_) {
+                EpochGate::leave(readers_);
             }
         }
         
-        // Invoke callback after lock release
-        // Set reentrancy prevention flag and execute callback
-        if (callback_to_invoke) {
-            in_callback_.store(true);
-            try {
-                callback_to_invoke();
-            } catch (...) {
-                in_callback_.store(false);
-                throw;
-            }
-            in_callback_.store(false);
-        }
+        uint32_t index() const noexcept { return index_; }
+
+    private:
+        friend class CommitDomain;
+        Frame(std::atomic<uint32_t>* readers, uint32_t index) noexcept
+            : readers_(readers), index_(index) {}
         
-        return updated;
+        std::atomic<uint32_t>* readers_;
+        uint32_t index_;
+    };
+    
+    /// Pin the current front (wait-free, never takes a lock)
+    Frame read() const noexcept {
+        auto* readers = gate_.enter();
+        return Frame(readers, front_.load());
     }
-
-    /**
-     * @brief Start file watching (automatic update)
-     * 
-     * Monitors file in background and marks file as changed; call poll() from main loop on changes.
-     */
-    void start_watching() {
-        // Skip processing during callback execution (prevent reentrancy)
-        if (in_callback_.load()) {
-            internal::log(LogLevel::Warning, 
-                "start_watching() called during callback execution - operation skipped");
-            return;
-        }
-        
-        std::lock_guard<std::mutex> lock(mtx_);
-        
-        if (file_watcher_ && file_watcher_->is_running()) {
-            return;
-        }
-        
-        file_watcher_ = std::make_unique<internal::FileWatcher>(file_watcher_config_);
-        file_changed_.store(true); // Initial read
-        
-        file_watcher_->start(file_path_, [this] {
-            file_changed_.store(true);
-        });
-    }
-
+    
+    // Writer side (serialized externally)
+    
+    uint32_t back() const noexcept { return front_.load(std::memory_order_relaxed) ^ 1u; }
+    void mark_staged() noexcept { staged_ = true; }
+    bool staged() const noexcept { return staged_; }
+    uint64_t commit_count() const noexcept { return commit_count_.load(std::memory_order_relaxed); }
+    
     /**
-     * @brief Stop file watching
+     * @brief Make the staged back copies current
+     * @return The new front index; the new back copies are free to write
      */
-    void stop_watching() {
-        // Skip processing during callback execution (prevent reentrancy)
-        if (in_callback_.load()) {
-            internal::log(LogLevel::Warning, 
-                "stop_watching() called during callback execution - operation skipped");
-            return;
-        }
-        
-        std::lock_guard<std::mutex> lock(mtx_);
-        if (file_watcher_) {
-            file_watcher_->stop();
-            file_watcher_.reset();
-        }
+    uint32_t flip() {
+        const uint32_t front = back();
+        front_.store(front);
+        gate_.synchronize();
+        staged_ = false;
+        commit_count_.fetch_add(1, std::memory_order_relaxed);
+        return front;
     }
 
-    /**
-     * @brief Check for file changes during watching and update
-     * 
-     * Use in combination with start_watching().
-     * 
-     * @return true if values were updated
-     */
-    bool poll() {
-        if (file_changed_.load()) {
-            file_changed_.store(false);
-            return update();
-        }
-        return false;
-    }
+private:
+    std::atomic<uint32_t> front_{0};
+    EpochGate gate_;
+    bool staged_ = false;
+    std::atomic<uint64_t> commit_count_{0};
+};
 
-    /**
-     * @brief Set callback for changes
-     * 
-     * @note Thread Safety: Callback runs on the thread calling update() (main thread).
-     * Safe for OpenGL/DirectX/UI operations.
-     */
-    void on_change(std::function<void()> callback) {
-        std::lock_guard<std::mutex> lock(mtx_);
-        on_change_callback_ = std::move(callback);
+/**
+ * @brief Immutable, versioned set of parameter values
+ *
+ * Published by Params::update() and read without locking. The value map is
+ * shared between snapshots that only differ in their slot table.
+ */
+struct ValueSnapshot {
+    using ValueMap = std::unordered_map<std::string, ParamValue>;
+    
+    std::shared_ptr<const ValueMap> values = std::make_shared<ValueMap>();
+    std::vector<const ParamValue*> slots;  ///< Indexed by resolved key slot (null if absent)
+    uint64_t version = 0;
+    
+    const ParamValue* at(uint32_t slot) const {
+        return slot < slots.size() ? slots[slot] : nullptr;
     }
+};
 
-    /**
-     * @brief Get last error information
-     */
-    ErrorInfo last_error() const {
-        std::lock_guard<std::mutex> lock(mtx_);
-        return last_error_;
+template<typename Target>
+struct BindingTraits;
+
+} // namespace internal
+
+class Params;
+
+/**
+ * @brief Pins one committed frame of Buffered<T> values
+ * @see Params::frame()
+ */
+using BufferedFrame = internal::CommitDomain::Frame;
+
+/**
+ * @brief Double-buffered bound variable for cross-thread readers
+ * 
+ * Bind with Params::bind(). update()/poll() stage new values into a back
+ * copy; Params::commit() makes every staged Buffered<T> of that Params
+ * visible at once. Readers on any thread call get() (or get(frame) to read
+ * several variables from the same commit) and never take a lock; a pinned
+ * frame only delays the next commit(), so keep it short.
+ * 
+ * Not copyable or movable: the binding refers to its address. It must
+ * outlive the binding, and must be bound before other threads read it.
+ */
+template<typename T>
+class Buffered {
+public:
+    Buffered() = default;
+    explicit Buffered(const T& initial) : buffers_{initial, initial} {}
+    
+    Buffered(const Buffered&) = delete;
+    Buffered& operator=(const Buffered&) = delete;
+    
+    /// Committed value (any thread, lock-free)
+    T get() const {
+        if (!domain_) {
+            return buffers_[0];
+        }
+        auto frame = domain_->read();
+        return buffers_[frame.index()];
     }
     
-    /**
-     * @brief Check if there is an error
-     */
-    bool has_error() const {
-        std::lock_guard<std::mutex> lock(mtx_);
-        return static_cast<bool>(last_error_);
+    /// Committed value of a pinned frame (Params::frame())
+    const T& get(const BufferedFrame& frame) const {
+        return buffers_[frame.index()];
     }
     
-    /**
-     * @brief Clear error
-     */
-    void clear_error() {
-        std::lock_guard<std::mutex> lock(mtx_);
-        last_error_ = ErrorInfo();
+    /// Value staged by the last update(), visible after commit() (updating thread only)
+    const T& staged() const {
+        return buffers_[domain_ ? domain_->back() : 0];
     }
 
-    /**
-     * @brief Get specific parameter value
-     */
-    template<typename T>
-    std::optional<T> get(const std::string& name) const {
-        std::lock_guard<std::mutex> lock(mtx_);
-        auto it = current_values_.find(name);
-        if (it != current_values_.end()) {
-            T value;
-            if (internal::parse_value(it->second, value)) {
-                return value;
-            }
+private:
+    template<typename>
+    friend struct internal::BindingTraits;
+    friend class Params;
+    
+    T& back() { return buffers_[domain_->back()]; }
+    
+    /// After a flip: bring the new back copy up to date with the new front
+    void sync(uint32_t front) {
+        if (dirty_) {
+            buffers_[front ^ 1u] = buffers_[front];
+            dirty_ = false;
         }
-        return std::nullopt;
     }
+    
+    T buffers_[2]{};
+    internal::CommitDomain* domain_ = nullptr;
+    bool dirty_ = false;
+};
 
-    /**
-     * @brief Get specific parameter value (with default)
-     */
-    template<typename T>
-    T get_or(const std::string& name, T default_value) const {
-        auto val = get<T>(name);
-        return val.value_or(default_value);
+/**
+ * @brief Seqlock-published value for cross-thread readers
+ * 
+ * For trivially copyable values too large for a lock-free std::atomic
+ * (vectors, colors, small structs). One writer (Params, when bound) stores
+ * whole values; readers on any thread copy the value and retry if a store
+ * overlapped, so they never block the writer and never take a lock. The
+ * value is held in atomic words, so a racing read is not a data race.
+ * 
+ * Bound values are parsed as T (operator>> for user types).
+ */
+template<typename T>
+class SeqLocked {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLocked<T> requires a trivially copyable T");
+    static_assert(std::is_default_constructible_v<T>, "SeqLocked<T> requires a default-constructible T");
+    
+public:
+    SeqLocked() : SeqLocked(T{}) {}
+    explicit SeqLocked(const T& initial) {
+        write_words(initial);
     }
-
-    /**
-     * @brief Check if parameter exists
-     */
-    bool has(const std::string& name) const {
-        std::lock_guard<std::mutex> lock(mtx_);
-        return current_values_.find(name) != current_values_.end();
+    
+    SeqLocked(const SeqLocked&) = delete;
+    SeqLocked& operator=(const SeqLocked&) = delete;
+    
+    /// Current value (any thread, lock-free; retries while a store overlaps)
+    T load() const {
+        for (;;) {
+            const uint64_t before = sequence_.load(std::memory_order_acquire);
+            if ((before & 1u) == 0) {
+                // Acquire loads keep the re-check after the copy: a word from a
+                // later store makes the re-check see its odd sequence
+                Word copy[word_count];
+                for (size_t i = 0; i < word_count; ++i) {
+                    copy[i] = words_[i].load(std::memory_order_acquire);
+                }
+                if (sequence_.load(std::memory_order_relaxed) == before) {
+                    T value;
+                    std::memcpy(&value, copy, sizeof(T));
+                    return value;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+    
+    /// Publish a new value (single writer)
+    void store(const T& value) {
+        const uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        write_words(value);  // Release stores, ordered after the odd sequence
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+    
+    /// Number of completed stores (even while idle)
+    uint64_t version() const {
+        return sequence_.load(std::memory_order_acquire) / 2;
     }
 
-    /**
-     * @brief Change file path
-     */
-    void set_file(std::string_view file_path, FileFormat format = FileFormat::Auto) {
-        // Skip processing during callback execution (prevent reentrancy)
-        if (in_callback_.load()) {
-            internal::log(LogLevel::Warning, 
-                "set_file() called during callback execution - operation skipped");
-            return;
-        }
-        
-        std::lock_guard<std::mutex> lock(mtx_);
-        file_path_ = file_path;
-        format_ = (format == FileFormat::Auto) ? internal::detect_format(file_path_) : format;
-        invalidate_cache();
-        
-        // If watching, restart
-        if (file_watcher_ && file_watcher_->is_running()) {
-            file_watcher_->stop();
-            file_watcher_->start(file_path_, [this] {
-                file_changed_.store(true);
-            });
+private:
+    using Word = uintptr_t;
+    static constexpr size_t word_count = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+    
+    void write_words(const T& value) {
+        Word copy[word_count] = {};
+        std::memcpy(copy, &value, sizeof(T));
+        for (size_t i = 0; i < word_count; ++i) {
+            words_[i].store(copy[i], std::memory_order_release);
         }
     }
+    
+    std::atomic<uint64_t> sequence_{0};
+    std::atomic<Word> words_[word_count];
+};
 
-    std::string get_file() const {
-        std::lock_guard<std::mutex> lock(mtx_);
-        return file_path_;
+namespace internal {
+
+// ============================================================
+// Binding Table
+// ============================================================
+
+/**
+ * @brief How a bound target is written
+ *
+ * value_type is the type defaults are kept in; convert() writes a loaded
+ * value, assign() a default. Targets with a staging area (Buffered<T>)
+ * also publish their staged writes on commit(). std::atomic<T> and
+ * SeqLocked<T> targets publish each value as it is written.
+ */
+template<typename Target>
+struct BindingTraits {
+    using value_type = Target;
+    static constexpr bool staged = false;
+    
+    static void attach(Target&, CommitDomain&) {}
+    static bool convert(const ParamValue& value, Target& target) {
+        return convert_value(value, target);
+    }
+    static void assign(Target& target, const value_type& value) {
+        target = value;
     }
+    static void publish(Target&, uint32_t) {}
+};
 
-    /**
-     * @brief Invalidate cache
-     */
-    void invalidate_cache() {
-        // Skip processing during callback execution (prevent reentrancy)
-        if (in_callback_.load()) {
-            internal::log(LogLevel::Warning, 
-                "invalidate_cache() called during callback execution - operation skipped");
-            return;
+/// Lock-free scalars: each value is stored with release ordering
+template<typename T>
+struct BindingTraits<std::atomic<T>> {
+    using value_type = T;
+    static constexpr bool staged = false;
+    
+    static void attach(std::atomic<T>&, CommitDomain&) {}
+    static bool convert(const ParamValue& value, std::atomic<T>& target) {
+        T converted{};
+        if (!convert_value(value, converted)) {
+            return false;
         }
-        
-        file_cache_ = FileCache{
-            std::filesystem::file_time_type::min(),
-            std::chrono::steady_clock::time_point{},
-            false
-        };
-        current_values_.clear();
+        target.store(converted, std::memory_order_release);
+        return true;
     }
+    static void assign(std::atomic<T>& target, const T& value) {
+        target.store(value, std::memory_order_release);
+    }
+    static void publish(std::atomic<T>&, uint32_t) {}
+};
 
-    /**
-     * @brief Reset all binds to default values
-     */
-    void reset_to_defaults() {
-        // Skip processing during callback execution (prevent reentrancy)
-        if (in_callback_.load()) {
-            internal::log(LogLevel::Warning, 
-                "reset_to_defaults() called during callback execution - operation skipped");
-            return;
-        }
-        
-        std::lock_guard<std::mutex> lock(mtx_);
-        for (auto& [name, binding] : bindings_) {
-            binding->apply_default();
+template<typename T>
+struct BindingTraits<SeqLocked<T>> {
+    using value_type = T;
+    static constexpr bool staged = false;
+    
+    static void attach(SeqLocked<T>&, CommitDomain&) {}
+    static bool convert(const ParamValue& value, SeqLocked<T>& target) {
+        T converted{};
+        if (!convert_value(value, converted)) {
+            return false;
         }
+        target.store(converted);
+        return true;
     }
+    static void assign(SeqLocked<T>& target, const T& value) {
+        target.store(value);
+    }
+    static void publish(SeqLocked<T>&, uint32_t) {}
+};
 
-    /**
-     * @brief Get list of bound parameter names
-     */
-    std::vector<std::string> get_bound_names() const {
-        std::lock_guard<std::mutex> lock(mtx_);
-        std::vector<std::string> names;
-        names.reserve(bindings_.size());
-        for (const auto& [name, _] : bindings_) {
-            names.push_back(name);
+template<typename T>
+struct BindingTraits<Buffered<T>> {
+    using value_type = T;
+    static constexpr bool staged = true;
+    
+    static void attach(Buffered<T>& target, CommitDomain& domain) {
+        target.domain_ = &domain;
+    }
+    static bool convert(const ParamValue& value, Buffered<T>& target) {
+        if (!convert_value(value, target.back())) {
+            return false;
         }
-        return names;
+        mark(target);
+        return true;
+    }
+    static void assign(Buffered<T>& target, const T& value) {
+        target.back() = value;
+        mark(target);
+    }
+    static void publish(Buffered<T>& target, uint32_t front) {
+        target.sync(front);
     }
 
 private:
-    void ensure_file_exists() {
-        if (!std::filesystem::exists(file_path_)) {
-            std::ofstream file(file_path_);
-            if (file) {
-                switch (format_) {
-                case FileFormat::Json:
-                    file << "{\n";
-                    file << "  // Live Tuner parameters\n";
-                    file << "  // Edit values here and save\n";
-                    file << "}\n";
-                    break;
-                case FileFormat::Yaml:
-                    file << "# Live Tuner parameters\n";
-                    file << "# Edit values here and save\n";
-                    file << "---\n";
-                    break;
-                default:
-                    file << "# Live Tuner parameters\n";
-                    file << "# Format: key = value\n";
-                    file << "\n";
-                    break;
-                }
-            }
-        }
+    static void mark(Buffered<T>& target) {
+        target.dirty_ = true;
+        target.domain_->mark_staged();
     }
+};
 
-    bool load_file() {
-        // Read file with retry logic
-        ErrorInfo read_error;
-        auto content_opt = internal::read_file_with_retry(file_path_, file_read_retry_config_, &read_error);
-        if (!content_opt) {
-            last_error_ = read_error;
-            return false;
+/**
+ * @brief Bindings of one target type (type-erased at segment granularity)
+ *
+ * One virtual call per segment and reload; the per-binding work is a
+ * linear sweep over a contiguous vector.
+ */
+class BindingSegmentBase {
+public:
+    virtual ~BindingSegmentBase() = default;
+    
+    /// Apply values (or defaults for missing keys) to every binding
+    virtual void apply(const ValueSnapshot& snapshot, const std::vector<std::string>& slot_keys) = 0;
+    /// Apply the value (or default) to a single binding
+    virtual void apply_one(uint32_t index, const ValueSnapshot& snapshot,
+                           const std::vector<std::string>& slot_keys) = 0;
+    virtual void apply_defaults() = 0;
+    /// Publish staged writes after CommitDomain::flip() (staged targets only)
+    virtual void publish(uint32_t front) = 0;
+    
+    /// Swap-and-pop removal; returns the slot of the entry moved into @p index
+    virtual uint32_t erase(uint32_t index) = 0;
+    virtual uint32_t slot_at(uint32_t index) const = 0;
+    virtual uint32_t size() const = 0;
+};
+
+template<typename Target>
+class BindingSegment : public BindingSegmentBase {
+public:
+    using Traits = BindingTraits<Target>;
+    using T = typename Traits::value_type;
+    
+    struct Entry {
+        Target* target;
+        T default_value;
+        uint32_t slot;
+    };
+    
+    uint32_t add(uint32_t slot, Target* target, T default_value) {
+        entries_.push_back(Entry{target, std::move(default_value), slot});
+        return static_cast<uint32_t>(entries_.size() - 1);
+    }
+    
+    void assign(uint32_t index, Target* target, T default_value) {
+        entries_[index].target = target;
+        entries_[index].default_value = std::move(default_value);
+    }
+    
+    void apply(const ValueSnapshot& snapshot, const std::vector<std::string>& slot_keys) override {
+        for (auto& entry : entries_) {
+            apply_entry(entry, snapshot, slot_keys);
         }
-        
-        const std::string& content = *content_opt;
-        
-        std::unordered_map<std::string, std::string> new_values;
-        bool parsed = false;
-        
-        switch (format_) {
-        case FileFormat::Json:
-            parsed = internal::PicojsonParser::parse(content, new_values);
-            if (!parsed && new_values.empty()) {
-                last_error_ = ErrorInfo(ErrorType::ParseError, 
-                                       "Failed to parse JSON format", file_path_);
-                internal::log(LogLevel::Error, last_error_.to_string());
-            }
-            break;
-        case FileFormat::Yaml:
-            parsed = internal::SimpleKeyValueParser::parse(content, new_values, true);
-            if (!parsed && new_values.empty()) {
-                last_error_ = ErrorInfo(ErrorType::ParseError, 
-                                       "Failed to parse YAML format", file_path_);
-                internal::log(LogLevel::Error, last_error_.to_string());
+    }
+    
+    void apply_one(uint32_t index, const ValueSnapshot& snapshot,
+                   const std::vector<std::string>& slot_keys) override {
+        apply_entry(entries_[index], snapshot, slot_keys);
+    }
+    
+    void apply_defaults() override {
+        for (auto& entry : entries_) {
+            Traits::assign(*entry.target, entry.default_value);
+        }
+    }
+    
+    void publish(uint32_t front) override {
+        if constexpr (Traits::staged) {
+            for (auto& entry : entries_) {
+                Traits::publish(*entry.target, front);
             }
-            break;
-        case FileFormat::KeyValue:
-        case FileFormat::Plain:
-        default:
-            parsed = internal::SimpleKeyValueParser::parse(content, new_values, false);
-            if (!parsed && new_values.empty()) {
-                last_error_ = ErrorInfo(ErrorType::ParseError, 
-                                       "Failed to parse key-value format", file_path_);
-                internal::log(LogLevel::Error, last_error_.to_string());
+        }
+    }
+    
+    uint32_t erase(uint32_t index) override {
+        if (index + 1 != entries_.size()) {
+            entries_[index] = std::move(entries_.back());
+        }
+        entries_.pop_back();
+        return index < entries_.size() ? entries_[index].slot : 0;
+    }
+    
+    uint32_t slot_at(uint32_t index) const override { return entries_[index].slot; }
+    uint32_t size() const override { return static_cast<uint32_t>(entries_.size()); }
+
+private:
+    static void apply_entry(Entry& entry, const ValueSnapshot& snapshot,
+                            const std::vector<std::string>& slot_keys) {
+        if (const ParamValue* value = snapshot.at(entry.slot)) {
+            if (!Traits::convert(*value, *entry.target)) {
+                // Record parse failure (warning level)
+                log(LogLevel::Warning, "Failed to parse value for parameter '" +
+                    slot_keys[entry.slot] + "': '" + value->text + "'");
             }
-            break;
+        } else {
+            Traits::assign(*entry.target, entry.default_value);
+        }
+    }
+    
+    std::vector<Entry> entries_;
+};
+
+/**
+ * @brief Bound variables grouped into per-type contiguous segments
+ *
+ * Bindings are addressed by key slot (see Params::handle()); at most one
+ * binding exists per slot.
+ */
+class BindingTable {
+public:
+    template<typename Target>
+    void bind(uint32_t slot, Target* target, typename BindingTraits<Target>::value_type default_value) {
+        uint32_t segment_index = segment_for<Target>();
+        auto& segment = static_cast<BindingSegment<Target>&>(*segments_[segment_index]);
+        
+        if (slot < locations_.size() && locations_[slot].segment == segment_index) {
+            segment.assign(locations_[slot].index, target, std::move(default_value));
+            return;
         }
+        unbind(slot);
         
-        if (!parsed && new_values.empty()) {
+        if (slot >= locations_.size()) {
+            locations_.resize(slot + 1);
+        }
+        locations_[slot] = Location{segment_index, segment.add(slot, target, std::move(default_value))};
+        ++count_;
+    }
+    
+    bool unbind(uint32_t slot) {
+        if (slot >= locations_.size() || locations_[slot].segment == npos) {
             return false;
         }
-        
-        // Check if values changed
-        bool any_changed = false;
-        for (const auto& [key, value] : new_values) {
-            auto it = current_values_.find(key);
-            if (it == current_values_.end() || it->second != value) {
-                any_changed = true;
-                break;
-            }
+        Location loc = locations_[slot];
+        auto& segment = *segments_[loc.segment];
+        uint32_t moved_slot = segment.erase(loc.index);
+        if (loc.index < segment.size()) {
+            locations_[moved_slot].index = loc.index;
         }
-        
-        if (!any_changed && new_values.size() == current_values_.size()) {
+        locations_[slot] = Location{};
+        --count_;
+        return true;
+    }
+    
+    void clear() {
+        segments_.clear();
+        segment_of_type_.clear();
+        locations_.clear();
+        count_ = 0;
+    }
+    
+    void apply(const ValueSnapshot& snapshot, const std::vector<std::string>& slot_keys) {
+        for (auto& segment : segments_) {
+            segment->apply(snapshot, slot_keys);
+        }
+    }
+    
+    /// Apply the binding for one slot, if any
+    bool apply_slot(uint32_t slot, const ValueSnapshot& snapshot, const std::vector<std::string>& slot_keys) {
+        if (slot >= locations_.size() || locations_[slot].segment == npos) {
             return false;
         }
-        
-        current_values_ = std::move(new_values);
-        
-        // Update bound variables
-        for (auto& [name, binding] : bindings_) {
-            auto it = current_values_.find(name);
-            if (it != current_values_.end()) {
-                if (!binding->update(it->second)) {
-                    // Record parse failure (warning level)
-                    std::string msg = "Failed to parse value for parameter '" + name + 
-                                    "': '" + it->second + "'";
-                    internal::log(LogLevel::Warning, msg);
-                }
-            } else {
-                binding->apply_default();
+        segments_[locations_[slot].segment]->apply_one(locations_[slot].index, snapshot, slot_keys);
+        return true;
+    }
+    
+    void apply_defaults() {
+        for (auto& segment : segments_) {
+            segment->apply_defaults();
+        }
+    }
+    
+    void publish(uint32_t front) {
+        for (auto& segment : segments_) {
+            segment->publish(front);
+        }
+    }
+    
+    size_t size() const { return count_; }
+    
+    /// Call fn(slot) for every bound slot
+    template<typename Fn>
+    void for_each_slot(Fn&& fn) const {
+        for (const auto& segment : segments_) {
+            for (uint32_t i = 0; i < segment->size(); ++i) {
+                fn(segment->slot_at(i));
             }
         }
-        
-        // Clear error on success
-        last_error_ = ErrorInfo();
-        
-        return true;
     }
+
+private:
+    static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+    
+    struct Location {
+        uint32_t segment = npos;
+        uint32_t index = 0;
+    };
+    
+    template<typename T>
+    uint32_t segment_for() {
+        auto [it, inserted] = segment_of_type_.emplace(
+            std::type_index(typeid(T)), static_cast<uint32_t>(segments_.size()));
+        if (inserted) {
+            segments_.push_back(std::make_unique<BindingSegment<T>>());
+        }
+        return it->second;
+    }
+    
+    std::vector<std::unique_ptr<BindingSegmentBase>> segments_;
+    std::unordered_map<std::type_index, uint32_t> segment_of_type_;
+    std::vector<Location> locations_;  ///< Indexed by slot
+    size_t count_ = 0;
 };
 
+} // namespace internal
+
 // ============================================================
-// LiveTuner Class
+// FileWatcherConfig Export
 // ============================================================
 
 /**
- * @brief Live parameter tuning (Low-level API)
+ * @brief File watcher configuration
  * 
- * @warning Event-driven callbacks run on background thread.
- * Not safe for OpenGL/DirectX. Use Params class for main-thread execution.
+ * Configure buffer size and overflow handling for file watching.
+ * @see Params::set_watcher_config()
  */
-class LiveTuner {
+using FileWatcherConfig = internal::FileWatcherConfig;
+
+/**
+ * @brief File read retry configuration
+ * 
+ * Prevents read errors while editor is writing (especially on Windows).
+ * @see Params::set_read_retry_config()
+ */
+using FileReadRetryConfig = internal::FileReadRetryConfig;
+
+// ============================================================
+// Params Class (Named Parameters)
+// ============================================================
+
+template<typename T>
+class ParamHandle;
+
+/**
+ * @brief Named parameter management
+ * 
+ * Binds multiple variables to a file and updates in batch.
+ * 
+ * @note Thread Safety: Callbacks run on the thread calling update() (main thread).
+ * Safe for OpenGL/DirectX. Differs from LiveTuner's background thread callbacks.
+ */
+class Params {
+    template<typename T>
+    friend class ParamHandle;
+
 public:
     struct FileCache {
-        std::filesystem::file_time_type last_modify_time;
-        std::chrono::steady_clock::time_point last_access;
         bool file_exists = false;
-        static constexpr std::chrono::milliseconds cache_duration{10};
+        
+        /// Negative cache: file could neither be found nor created
+        bool file_missing = false;
+        std::chrono::steady_clock::time_point missing_until{};
+        static constexpr std::chrono::milliseconds missing_retry_interval{250};
     };
 
 private:
     mutable std::mutex mtx_;
-    std::string input_file_path_ = "params.txt";
-    FileCache file_cache_{
-        std::filesystem::file_time_type::min(),
-        std::chrono::steady_clock::time_point{},
-        false
-    };
+    std::string file_path_;
+    FileFormat format_ = FileFormat::Auto;
+    FileCache file_cache_;
+    internal::FileChangeDetector change_detector_;
+    
+    internal::BindingTable bindings_;
+    // Front/back selector of Buffered<T> bindings (stable address across moves)
+    std::unique_ptr<internal::CommitDomain> commit_domain_ = std::make_unique<internal::CommitDomain>();
+    
+    // Current values, published for lock-free readers (written under mtx_)
+    internal::SnapshotCell<internal::ValueSnapshot> snapshot_{
+        std::make_unique<const internal::ValueSnapshot>()};
+    
+    // Keys resolved to stable slot indices (append-only, for ParamHandle)
+    std::unordered_map<std::string, uint32_t> key_slots_;
+    std::vector<std::string> slot_keys_;
+    
+    // Keys added, changed or removed by the last successful load
+    std::vector<std::string> changed_keys_;
+    // Published values were reset (invalidate_cache); next load re-applies every binding
+    bool full_apply_pending_ = true;
+    
+    // Bindings still to be assigned from the published values (poll(budget)
+    // spreads them over several calls). Values are always read from the
+    // newest snapshot, so reloads merge into the queue.
+    std::vector<uint32_t> pending_slots_;
+    size_t pending_pos_ = 0;
+    std::vector<bool> slot_queued_;
+    bool apply_all_queued_ = false;  ///< Every binding is queued (pending_slots_ unused)
+    bool notify_pending_ = false;    ///< Run the change callback once the queue drains
+    std::atomic<bool> apply_pending_{false};
+    
+    // Hash of the last accepted file contents (identical rewrites skip parsing)
+    std::optional<uint64_t> content_hash_;
+    uint64_t skipped_parse_count_ = 0;
+    
+    // Bound names, republished lazily after bind()/unbind()
+    mutable internal::SnapshotCell<std::vector<std::string>> bound_names_{
+        std::make_unique<const std::vector<std::string>>()};
+    mutable std::atomic<bool> bound_names_dirty_{false};
+    
     std::unique_ptr<internal::FileWatcher> file_watcher_;
     internal::FileWatcherConfig file_watcher_config_;
     internal::FileReadRetryConfig file_read_retry_config_;
+    internal::FileReader file_reader_;  ///< Buffer reused across reloads
+    internal::DeferredRetry read_retry_;
     bool use_event_driven_ = true;
+    std::atomic<bool> file_changed_{false};
+    std::atomic<bool> watching_{false};  ///< A running watcher reports every change via file_changed_
+    
+    /// A reload read and parsed off the calling thread, ready to commit
+    struct PreparedLoad {
+        bool failed = false;        ///< Read or parse error (see error)
+        bool same_content = false;  ///< Bytes hash equal to the base: nothing to parse
+        ErrorInfo error;
+        uint64_t content_hash = 0;
+        uint64_t base_version = 0;  ///< Version the values were diffed against
+        std::shared_ptr<internal::ValueSnapshot::ValueMap> values;
+        std::vector<std::string> changed;
+    };
+    
+    /**
+     * @brief State shared with the background parse worker
+     * 
+     * The worker only touches this object (never the Params), so watcher
+     * callbacks and the worker hold it by shared_ptr.
+     */
+    struct ParseChannel {
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool requested = false;
+        bool stop = false;
+        
+        // Inputs: file settings copied at start_watching(); the base is the
+        // published state, refreshed after every publish
+        std::string path;
+        FileFormat format = FileFormat::Auto;
+        internal::FileReadRetryConfig retry;
+        std::shared_ptr<const internal::ValueSnapshot::ValueMap> base;
+        uint64_t base_version = 0;
+        std::optional<uint64_t> base_hash;
+        
+        // Output: latest result (a newer one replaces an unconsumed one)
+        std::optional<PreparedLoad> prepared;
+        std::atomic<bool> ready{false};
+        
+        void request() {
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                requested = true;
+            }
+            cv.notify_one();
+        }
+    };
+    
+    bool background_parse_ = false;
+    std::shared_ptr<ParseChannel> parse_channel_;  ///< Set while a worker runs (under mtx_)
+    std::thread parse_thread_;
+    std::atomic<bool> parse_active_{false};  ///< parse_channel_ is set, readable without mtx_
     
     // Error information
     ErrorInfo last_error_;
+    
+    // Callback
+    std::function<void()> on_change_callback_;
+    
+    // Reentrancy prevention flag (whether callback is executing)
+    std::atomic<bool> in_callback_{false};
 
 public:
-    LiveTuner() = default;
-    
-    explicit LiveTuner(std::string_view file_path) : input_file_path_(file_path) {}
+    /**
+     * @brief Constructor
+     * @param file_path Path to configuration file
+     * @param format File format (default: auto-detect)
+     */
+    explicit Params(std::string_view file_path = "params.json", 
+                   FileFormat format = FileFormat::Auto)
+        : file_path_(file_path)
+        , format_(format) 
+    {
+        if (format_ == FileFormat::Auto) {
+            format_ = internal::detect_format(file_path_);
+        }
+    }
     
     /**
      * @brief Get file read retry configuration
      */
-    const internal::FileReadRetryConfig& get_read_retry_config() const {
+    internal::FileReadRetryConfig get_read_retry_config() const {
         std::lock_guard<std::mutex> lock(mtx_);
         return file_read_retry_config_;
     }
@@ -2315,1479 +3087,4241 @@ public:
         file_read_retry_config_ = config;
     }
     
-    LiveTuner(const LiveTuner&) = delete;
-    LiveTuner& operator=(const LiveTuner&) = delete;
-    LiveTuner(LiveTuner&&) noexcept;
-    LiveTuner& operator=(LiveTuner&&) noexcept;
-    
-    ~LiveTuner();
-
-    /**
-     * @brief Set file path to monitor
-     */
-    void set_file(std::string_view file_path) {
-        std::lock_guard<std::mutex> lock(mtx_);
-        input_file_path_ = file_path;
-        invalidate_cache();
-    }
+    ~Params();
     
-    std::string get_file() const {
-        std::lock_guard<std::mutex> lock(mtx_);
-        return input_file_path_;
-    }
+    Params(const Params&) = delete;
+    Params& operator=(const Params&) = delete;
+    Params(Params&&);
+    Params& operator=(Params&&);
 
     /**
      * @brief Get file watcher configuration
      */
-    const internal::FileWatcherConfig& get_watcher_config() const {
+    internal::FileWatcherConfig get_watcher_config() const {
         std::lock_guard<std::mutex> lock(mtx_);
         return file_watcher_config_;
     }
     
     /**
      * @brief Set file watcher configuration
+     * 
+     * Changes take effect on next start_watching() call.
      */
     void set_watcher_config(const internal::FileWatcherConfig& config) {
         std::lock_guard<std::mutex> lock(mtx_);
         file_watcher_config_ = config;
         file_watcher_config_.validate();
-        
-        if (file_watcher_) {
-            file_watcher_->set_config(file_watcher_config_);
-        }
     }
-
+    
     /**
-     * @brief Enable/disable event-driven mode
+     * @brief Read and parse reloads on a worker thread while watching
+     * 
+     * A change reported by the watcher is read, parsed and diffed against
+     * the published values on a worker; poll() and update() then only
+     * commit the prepared values, assign the changed bindings and run the
+     * change callback, still on the calling thread. Takes effect on the
+     * next start_watching() call.
      */
-    void set_event_driven(bool enabled) {
+    void set_background_parse(bool enabled) {
         std::lock_guard<std::mutex> lock(mtx_);
-        use_event_driven_ = enabled;
-        if (file_watcher_) {
-            file_watcher_->stop();
-            file_watcher_.reset();
-        }
+        background_parse_ = enabled;
     }
     
-    bool is_event_driven() const {
+    bool background_parse() const {
         std::lock_guard<std::mutex> lock(mtx_);
-        return use_event_driven_;
-    }
-    
-    static bool has_native_file_watch() {
-        return internal::FileWatcher::has_native_support();
+        return background_parse_;
     }
 
     /**
-     * @brief Get last error information
+     * @brief Bind variable to parameter
+     * 
+     * The variable is set to the loaded value right away, or to
+     * @p default_value if the key has not been loaded. Besides plain
+     * variables (written in place on the updating thread), these targets
+     * can be read from other threads without a lock:
+     * - std::atomic<T>: each value is stored with release ordering
+     * - SeqLocked<T>: trivially copyable structs, published under a seqlock
+     * - Buffered<T>: staged, visible to all readers at once at commit()
      */
-    ErrorInfo last_error() const {
+    template<typename Target>
+    void bind(const std::string& name, Target& variable,
+              typename internal::BindingTraits<Target>::value_type default_value = {}) {
+        using Traits = internal::BindingTraits<Target>;
         std::lock_guard<std::mutex> lock(mtx_);
-        return last_error_;
+        Traits::attach(variable, *commit_domain_);
+        bindings_.bind(resolve_slot(name), &variable, default_value);
+        Traits::assign(variable, default_value);
+        
+        // Reloads only re-apply changed keys: take the value already loaded
+        // (looked up by name; the slot may be newer than the snapshot)
+        auto current = snapshot_.read();
+        auto it = current->values->find(name);
+        if (it != current->values->end() && !Traits::convert(it->second, variable)) {
+            internal::log(LogLevel::Warning, "Failed to parse value for parameter '" +
+                name + "': '" + it->second.text + "'");
+        }
+        bound_names_dirty_.store(true);
     }
     
     /**
-     * @brief Check if there is an error
-     */
-    bool has_error() const {
+     * @brief Make staged Buffered<T> values visible to all readers at once
+     * 
+     * Call at a frame boundary, typically right after update()/poll().
+     * Waits for readers still pinning the previous frame (never for the
+     * lock-free Buffered::get() calls that start afterwards). While
+     * poll(budget) still has bindings queued nothing is published, so a
+     * frame never mixes two reloads; commit once it reports none pending.
+     * 
+     * @return true if anything was published
+     */
+    bool commit() {
         std::lock_guard<std::mutex> lock(mtx_);
-        return static_cast<bool>(last_error_);
+        if (!commit_domain_->staged() || queued_bindings() != 0) {
+            return false;
+        }
+        bindings_.publish(commit_domain_->flip());
+        return true;
     }
     
     /**
-     * @brief Clear error
+     * @brief Pin the committed Buffered<T> values for coherent multi-variable reads
+     * 
+     * Lock-free. All get(frame) calls see the same commit; commit() waits
+     * while the frame is alive.
      */
-    void clear_error() {
+    BufferedFrame frame() const {
+        return commit_domain_->read();
+    }
+    
+    /**
+     * @brief Number of commit() calls that published staged values
+     */
+    uint64_t commit_count() const {
+        return commit_domain_->commit_count();
+    }
+
+    /**
+     * @brief Unbind parameter
+     */
+    void unbind(const std::string& name) {
         std::lock_guard<std::mutex> lock(mtx_);
-        last_error_ = ErrorInfo();
+        auto it = key_slots_.find(name);
+        if (it != key_slots_.end() && bindings_.unbind(it->second)) {
+            bound_names_dirty_.store(true);
+        }
     }
 
     /**
-     * @brief Try to read value immediately (non-blocking)
+     * @brief Unbind all parameters
+     */
+    void unbind_all() {
+        // Skip processing during callback execution (prevent reentrancy)
+        if (in_callback_.load()) {
+            internal::log(LogLevel::Warning, 
+                "unbind_all() called during callback execution - operation skipped");
+            return;
+        }
+        
+        std::lock_guard<std::mutex> lock(mtx_);
+        bindings_.clear();
+        bound_names_dirty_.store(true);
+    }
+
+    /**
+     * @brief Read file and update bound variables (non-blocking)
      * 
-     * Updates value only when file has changed.
-     * Optimal for game loops and frequent calls.
-     * Built-in retry logic to avoid file write conflicts with editors.
+     * @return true if values were updated
      * 
-     * @param value Variable to store read value
-     * @return true if value was updated
+     * While start_watching() is active this costs a single atomic load until
+     * the watcher reports a change; otherwise it stats the file once per call.
      * 
-     * @note Thread-safe: This method can be safely called from multiple threads.
-     *       The file cache is protected by mutex to prevent data races.
+     * @note Thread Safety:
+     * This method should be called from your main thread (e.g., in the game loop).
+     * Any registered callback via on_change() will be executed synchronously on
+     * the SAME THREAD that calls this method, ensuring safe access to
+     * main-thread-only resources like OpenGL/DirectX contexts.
      */
-    template<typename T>
-    bool try_get(T& value) {
-        std::string input_path;
-        internal::FileReadRetryConfig retry_config;
-        
-        auto now = std::chrono::steady_clock::now();
-        
-        // Phase 1: Check cache and get configuration (locked)
-        {
-            std::lock_guard<std::mutex> lock(mtx_);
-            input_path = input_file_path_;
-            retry_config = file_read_retry_config_;
+    bool update() {
+        // Background parse: the worker loads, commit what it prepared
+        if (parse_active_.load(std::memory_order_acquire)) {
+            return poll_until(std::nullopt).updated;
         }
         
-        ensure_file_exists(input_path);
-        
-        // Phase 2: Get current file modification time (unlocked - filesystem operation)
-        auto current_modify_time = internal::get_file_modify_time(input_path);
-        
-        // Phase 3: Re-check cache with modification time (locked)
-        {
-            std::lock_guard<std::mutex> lock(mtx_);
-            // Early return if within cache valid period and modification time is same
-            if (file_cache_.file_exists && 
-                (now - file_cache_.last_access) < FileCache::cache_duration &&
-                current_modify_time == file_cache_.last_modify_time) {
-                return false;
-            }
+        // Idle fast path: the watcher reports every change, nothing to check
+        if (watching_.load(std::memory_order_acquire) &&
+            !file_changed_.load(std::memory_order_acquire) &&
+            !apply_pending_.load(std::memory_order_acquire)) {
+            return false;
         }
         
-        // Phase 4: Read file (unlocked - I/O operation)
-        ErrorInfo read_error;
-        auto content_opt = internal::read_file_with_retry(input_path, retry_config, &read_error);
-        if (!content_opt) {
-            std::lock_guard<std::mutex> lock(mtx_);
-            last_error_ = read_error;
-            file_cache_.file_exists = false;
-            file_cache_.last_access = now;
+        // Prevent reentrancy during callback execution
+        if (in_callback_.load()) {
+            internal::log(LogLevel::Debug, 
+                "update() called during callback execution - skipped to prevent recursion");
             return false;
         }
         
-        // Phase 5: Parse content (unlocked - CPU operation)
-        std::istringstream stream(*content_opt);
-        std::string line;
-        bool value_found = false;
-        T parsed_value{};
-        std::string failed_line;
-        bool parse_error = false;
-        
-        while (std::getline(stream, line)) {
-            line = internal::trim(line);
-            
-            if (!line.empty() && line[0] != '#') {
-                if (internal::parse_value(line, parsed_value)) {
-                    value_found = true;
-                    break;
-                } else {
-                    // Parse failure - save for error reporting
-                    failed_line = line;
-                    parse_error = true;
-                }
-            }
-        }
+        bool updated = false;
+        std::function<void()> callback_to_invoke;
         
-        // Phase 6: Update cache and state (locked)
         {
             std::lock_guard<std::mutex> lock(mtx_);
+            reload_if_changed();
+            updated = apply_queued(std::nullopt, nullptr);
             
-            if (value_found) {
-                // On success, clear error and update cache
-                value = std::move(parsed_value);
-                file_cache_.last_modify_time = current_modify_time;
-                file_cache_.last_access = now;
-                file_cache_.file_exists = true;
-                last_error_ = ErrorInfo();
-                return true;
-            }
-            
-            if (parse_error) {
-                last_error_ = ErrorInfo(ErrorType::ParseError,
-                                      "Failed to parse value from line: '" + failed_line + "'",
-                                      input_path);
-                internal::log(LogLevel::Warning, last_error_.to_string());
-            } else {
-                last_error_ = ErrorInfo(ErrorType::ParseError,
-                                      "No valid value found in file",
-                                      input_path);
-                internal::log(LogLevel::Debug, last_error_.to_string());
+            // Copy callback and invoke outside lock (prevent deadlock)
+            if (updated && on_change_callback_) {
+                callback_to_invoke = on_change_callback_;
             }
-            
-            file_cache_.last_modify_time = current_modify_time;
-            file_cache_.last_access = now;
-            file_cache_.file_exists = true;
         }
         
-        return false;
+        run_change_callback(callback_to_invoke);
+        return updated;
     }
 
     /**
-     * @brief Block until value is read
+     * @brief Start file watching (automatic update)
+     * 
+     * Monitors file in background and marks file as changed; call poll() from main loop on changes.
      */
-    template<typename T>
-    void get(T& value) {
-        std::string input_path;
-        bool event_driven;
-        {
-            std::lock_guard<std::mutex> lock(mtx_);
-            input_path = input_file_path_;
-            event_driven = use_event_driven_;
+    void start_watching() {
+        // Skip processing during callback execution (prevent reentrancy)
+        if (in_callback_.load()) {
+            internal::log(LogLevel::Warning, 
+                "start_watching() called during callback execution - operation skipped");
+            return;
         }
         
-        ensure_file_exists(input_path);
+        std::lock_guard<std::mutex> lock(mtx_);
         
-        if (event_driven) {
-            get_event_driven(value, input_path);
+        if (file_watcher_ && file_watcher_->is_running()) {
+            return;
+        }
+        
+        file_watcher_ = std::make_unique<internal::FileWatcher>(file_watcher_config_);
+        
+        bool started = false;
+        if (background_parse_) {
+            ensure_file_exists();
+            parse_channel_ = std::make_shared<ParseChannel>();
+            parse_channel_->path = file_path_;
+            parse_channel_->format = format_;
+            parse_channel_->retry = file_read_retry_config_;
+            parse_channel_->retry.deferred = false;  // The worker may wait
+            sync_parse_base();
+            
+            started = file_watcher_->start(file_path_, [channel = parse_channel_] {
+                channel->request();
+            });
+            if (started) {
+                parse_thread_ = std::thread(&Params::run_parse_worker, parse_channel_);
+                parse_channel_->request();  // Initial read
+                parse_active_.store(true, std::memory_order_release);
+            } else {
+                parse_channel_.reset();  // Load inline instead
+                file_changed_.store(true);
+            }
         } else {
-            get_polling(value, input_path);
+            file_changed_.store(true); // Initial read
+            started = file_watcher_->start(file_path_, [this] {
+                file_changed_.store(true, std::memory_order_release);
+            });
         }
+        watching_.store(started, std::memory_order_release);
     }
 
     /**
-     * @brief Read value with timeout
+     * @brief Stop file watching
      */
-    template<typename T>
-    bool get_timeout(T& value, std::chrono::milliseconds timeout) {
-        std::string input_path;
-        bool event_driven;
+    void stop_watching() {
+        // Skip processing during callback execution (prevent reentrancy)
+        if (in_callback_.load()) {
+            internal::log(LogLevel::Warning, 
+                "stop_watching() called during callback execution - operation skipped");
+            return;
+        }
+        
+        std::shared_ptr<ParseChannel> channel;
+        std::thread worker;
         {
             std::lock_guard<std::mutex> lock(mtx_);
-            input_path = input_file_path_;
-            event_driven = use_event_driven_;
+            watching_.store(false);
+            if (file_watcher_) {
+                file_watcher_->stop();
+                file_watcher_.reset();
+            }
+            channel = std::move(parse_channel_);
+            worker = std::move(parse_thread_);
+            parse_active_.store(false, std::memory_order_release);
         }
         
-        ensure_file_exists(input_path);
-        
-        if (event_driven) {
-            return get_timeout_event_driven(value, input_path, timeout);
-        } else {
-            return get_timeout_polling(value, input_path, timeout);
-        }
+        // Joined outside mtx_: the worker finishes the reload in progress first
+        stop_parse_worker(channel, worker);
     }
 
     /**
-     * @brief Read value asynchronously (future version)
+     * @brief Check for file changes during watching and update
+     * 
+     * Use in combination with start_watching(). With set_background_parse()
+     * the file was already read and parsed on a worker: poll() commits the
+     * prepared values and runs bindings and the change callback.
+     * 
+     * @return true if values were updated
      */
-    template<typename T>
-    std::future<T> get_async() {
-        return std::async(std::launch::async, [this]() {
-            T value{};
-            get(value);
-            return value;
-        });
+    bool poll() {
+        return poll_until(std::nullopt).updated;
     }
-
+    
     /**
-     * @brief Read value asynchronously (callback version)
+     * @brief Progress of a budgeted poll
      */
-    template<typename T, typename Callback>
-    void get_async(Callback callback) {
-        std::thread([this, callback = std::move(callback)]() {
-            T value{};
-            get(value);
-            callback(value);
-        }).detach();
+    struct PollProgress {
+        bool updated = false;  ///< A reload finished applying (the change callback ran)
+        size_t applied = 0;    ///< Bindings assigned by this call
+        size_t pending = 0;    ///< Bindings still to be assigned by later calls
+    };
+    
+    /**
+     * @brief Check for changes and assign bindings within a time budget
+     * 
+     * A reload is published at once: get() and handles see the new values
+     * together. Bound variables are then assigned in batches of
+     * bind_batch_size, stopping once the budget is spent (at least one batch
+     * per call), and the rest is left to later calls. Each variable is
+     * assigned whole, from the newest values; a reload arriving before the
+     * queue drains is merged into it. The change callback runs once, in the
+     * call that assigns the last binding, and is not counted against the
+     * budget. update() and poll() finish any pending work.
+     * 
+     * Reading and parsing the file are not budgeted; combine with
+     * set_background_parse() to keep them off the calling thread.
+     */
+    PollProgress poll(std::chrono::microseconds budget) {
+        return poll_until(std::chrono::steady_clock::now() + budget);
+    }
+    
+    /**
+     * @brief Bindings queued by poll(budget) and not yet assigned
+     */
+    size_t pending_bindings() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return queued_bindings();
     }
+    
+    /// Bindings assigned between two deadline checks of poll(budget)
+    static constexpr size_t bind_batch_size = 32;
 
     /**
-     * @brief Invalidate cache
+     * @brief Descriptor for an external event loop (thread-less watching)
+     * 
+     * With FileWatcherConfig::external_loop set before start_watching(), the
+     * watcher starts no thread: add this fd to your epoll/poll set and call
+     * process_events() when it is readable. -1 otherwise.
      */
-    void invalidate_cache() {
-        file_cache_ = FileCache{
-            std::filesystem::file_time_type::min(),
-            std::chrono::steady_clock::time_point{},
-            false
-        };
+    int event_fd() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return file_watcher_ ? file_watcher_->event_fd() : -1;
     }
 
     /**
-     * @brief Reset state (clear cache)
+     * @brief Timeout for the external event loop (ms, -1 if nothing is pending)
+     * 
+     * Call process_events() when it elapses (debounce and settle checks).
      */
-    void reset() {
+    int next_timeout() const {
         std::lock_guard<std::mutex> lock(mtx_);
-        // Don't reset file path (maintain path set by set_file)
-        if (file_watcher_) {
-            file_watcher_->stop();
-            file_watcher_.reset();
-        }
-        invalidate_cache();
+        return file_watcher_ ? file_watcher_->next_timeout() : -1;
     }
 
-private:
-    void ensure_file_exists(const std::string& path) {
-        if (!std::filesystem::exists(path)) {
-            std::ofstream file(path);
-            if (file) {
-                file << "# Live Tuner parameters (edit values here)\n";
-                file << "# Lines starting with # are comments\n";
+    /**
+     * @brief Handle watcher events inline, then update (thread-less watching)
+     * 
+     * Runs on the calling thread: reads queued events, runs due timers and
+     * applies a reported change like poll().
+     * 
+     * @return true if values were updated
+     */
+    bool process_events() {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (file_watcher_) {
+                file_watcher_->process_events();
             }
         }
+        return poll();
     }
 
-    template<typename T>
-    void get_event_driven(T& value, const std::string& input_path) {
-        auto watcher = std::make_unique<internal::FileWatcher>(file_watcher_config_);
-        std::atomic<bool> file_changed{true};
-        
-        internal::FileReadRetryConfig retry_config;
-        {
-            std::lock_guard<std::mutex> lock(mtx_);
-            retry_config = file_read_retry_config_;
+    /**
+     * @brief Set callback for changes
+     * 
+     * @note Thread Safety: Callback runs on the thread calling update() (main thread).
+     * Safe for OpenGL/DirectX/UI operations.
+     */
+    void on_change(std::function<void()> callback) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        on_change_callback_ = std::move(callback);
+    }
+
+    /**
+     * @brief Get last error information
+     */
+    ErrorInfo last_error() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return last_error_;
+    }
+    
+    /**
+     * @brief Check if there is an error
+     */
+    bool has_error() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return static_cast<bool>(last_error_);
+    }
+    
+    /**
+     * @brief Clear error
+     */
+    void clear_error() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        last_error_ = ErrorInfo();
+    }
+
+    /**
+     * @brief Get specific parameter value
+     * 
+     * @note Lock-free: reads the last published snapshot and never waits
+     *       for a concurrent update().
+     */
+    template<typename T>
+    std::optional<T> get(const std::string& name) const {
+        auto snapshot = snapshot_.read();
+        auto it = snapshot->values->find(name);
+        if (it != snapshot->values->end()) {
+            T value;
+            if (internal::convert_value(it->second, value)) {
+                return value;
+            }
         }
-        
-        if (!watcher->start(input_path, [&file_changed] {
-            file_changed.store(true);
-        })) {
-            std::lock_guard<std::mutex> lock(mtx_);
-            last_error_ = ErrorInfo(ErrorType::WatcherError,
-                                  "Failed to start file watcher, falling back to polling mode",
-                                  input_path);
-            internal::log(LogLevel::Warning, last_error_.to_string());
-            internal::log(LogLevel::Info, 
-                "LiveTuner: Event-driven file watching failed for '" + input_path + "'. "
-                "Falling back to polling mode (100ms interval). "
-                "This may occur due to: OS watcher resource limits, unsupported filesystem, "
-                "or permission issues. Performance may be slightly reduced.");
-            get_polling(value, input_path);
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Get specific parameter value (with default)
+     */
+    template<typename T>
+    T get_or(const std::string& name, T default_value) const {
+        auto val = get<T>(name);
+        return val.value_or(default_value);
+    }
+
+    /**
+     * @brief Check if parameter exists
+     */
+    bool has(const std::string& name) const {
+        auto snapshot = snapshot_.read();
+        return snapshot->values->find(name) != snapshot->values->end();
+    }
+
+    /**
+     * @brief Resolve a parameter name once for hot-path access
+     * 
+     * The returned handle reads by slot index: no hashing, no allocation
+     * (for arithmetic types) and no locking. It stays valid across reloads,
+     * including keys that disappear and come back, for the lifetime of this
+     * Params object (it is not carried over by moves).
+     * 
+     * @code
+     * auto speed = params.handle<float>("player.speed");
+     * while (running) {
+     *     params.update();
+     *     player.move(speed.get_or(1.0f));
+     * }
+     * @endcode
+     */
+    template<typename T>
+    ParamHandle<T> handle(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        uint32_t slot = resolve_slot(name);
+        if (slot >= snapshot_.read()->slots.size()) {
+            republish_slots();
+        }
+        return ParamHandle<T>(this, slot);
+    }
+
+    /**
+     * @brief Get keys that were added, changed or removed by the last reload
+     * 
+     * Only bindings for these keys were re-assigned. Sorted by name.
+     * After invalidate_cache() the next reload reports every key.
+     */
+    std::vector<std::string> changed_keys() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return changed_keys_;
+    }
+
+    /**
+     * @brief Get number of reloads skipped because the contents were unchanged
+     * 
+     * Counts reads whose bytes hashed equal to the last accepted contents
+     * (e.g. touch-on-save or formatter rewrites); those are not parsed.
+     */
+    uint64_t skipped_parse_count() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return skipped_parse_count_;
+    }
+
+    /**
+     * @brief Get version of the published values
+     * 
+     * Incremented every time update() publishes a new set of values.
+     */
+    uint64_t version() const {
+        return snapshot_.read()->version;
+    }
+
+    /**
+     * @brief Change file path
+     */
+    void set_file(std::string_view file_path, FileFormat format = FileFormat::Auto) {
+        // Skip processing during callback execution (prevent reentrancy)
+        if (in_callback_.load()) {
+            internal::log(LogLevel::Warning, 
+                "set_file() called during callback execution - operation skipped");
             return;
         }
         
-        bool value_read = false;
-        while (!value_read) {
-            if (file_changed.load()) {
-                file_changed.store(false);
-                
-                // Read file with retry logic
-                ErrorInfo read_error;
-                auto content_opt = internal::read_file_with_retry(input_path, retry_config, &read_error);
-                if (content_opt) {
-                    std::istringstream stream(*content_opt);
-                    std::string line;
-                    bool parsed = false;
-                    while (std::getline(stream, line)) {
-                        line = internal::trim(line);
-                        
-                        if (!line.empty() && line[0] != '#') {
-                            if (internal::parse_value(line, value)) {
-                                value_read = true;
-                                parsed = true;
-                                std::lock_guard<std::mutex> lock(mtx_);
-                                last_error_ = ErrorInfo(); // Clear error on success
-                                break;
-                            }
-                        }
-                    }
-                    if (!parsed) {
-                        std::lock_guard<std::mutex> lock(mtx_);
-                        last_error_ = ErrorInfo(ErrorType::ParseError,
-                                              "No valid value found in file",
-                                              input_path);
-                        internal::log(LogLevel::Debug, last_error_.to_string());
-                    }
+        std::lock_guard<std::mutex> lock(mtx_);
+        file_path_ = file_path;
+        format_ = (format == FileFormat::Auto) ? internal::detect_format(file_path_) : format;
+        if (parse_channel_) {
+            // Before the new base is published: a load of the old file is
+            // prepared against the old version and discarded
+            std::lock_guard<std::mutex> channel_lock(parse_channel_->mtx);
+            parse_channel_->path = file_path_;
+            parse_channel_->format = format_;
+        }
+        invalidate_cache_unlocked();
+        
+        // If watching, restart
+        if (file_watcher_ && file_watcher_->is_running()) {
+            file_watcher_->stop();
+            bool started = false;
+            if (parse_channel_) {
+                ensure_file_exists();
+                started = file_watcher_->start(file_path_, [channel = parse_channel_] {
+                    channel->request();
+                });
+                if (started) {
+                    parse_channel_->request();  // Initial read of the new file
                 } else {
-                    std::lock_guard<std::mutex> lock(mtx_);
-                    last_error_ = read_error;
+                    // The worker never takes mtx_, so it can be joined here
+                    stop_parse_worker(parse_channel_, parse_thread_);
+                    parse_channel_.reset();  // Load inline instead
+                    parse_active_.store(false, std::memory_order_release);
                 }
+            } else {
+                started = file_watcher_->start(file_path_, [this] {
+                    file_changed_.store(true, std::memory_order_release);
+                });
             }
-            
-            if (!value_read) {
-                watcher->wait_for_change(std::chrono::milliseconds(1000));
-            }
+            watching_.store(started, std::memory_order_release);
         }
-        
-        watcher->stop();
     }
-    
-    template<typename T>
-    void get_polling(T& value, const std::string& input_path) {
-        internal::FileReadRetryConfig retry_config;
-        {
-            std::lock_guard<std::mutex> lock(mtx_);
-            retry_config = file_read_retry_config_;
+
+    std::string get_file() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return file_path_;
+    }
+
+    /**
+     * @brief Invalidate cache
+     */
+    void invalidate_cache() {
+        // Skip processing during callback execution (prevent reentrancy)
+        if (in_callback_.load()) {
+            internal::log(LogLevel::Warning, 
+                "invalidate_cache() called during callback execution - operation skipped");
+            return;
         }
         
-        bool value_read = false;
+        std::lock_guard<std::mutex> lock(mtx_);
+        invalidate_cache_unlocked();
+    }
+
+    /**
+     * @brief Reset all binds to default values
+     */
+    void reset_to_defaults() {
+        // Skip processing during callback execution (prevent reentrancy)
+        if (in_callback_.load()) {
+            internal::log(LogLevel::Warning, 
+                "reset_to_defaults() called during callback execution - operation skipped");
+            return;
+        }
         
-        while (!value_read) {
-            // Read file with retry logic
-            ErrorInfo read_error;
-            auto content_opt = internal::read_file_with_retry(input_path, retry_config, &read_error);
-            if (content_opt) {
-                std::istringstream stream(*content_opt);
-                std::string line;
-                bool parsed = false;
-                while (std::getline(stream, line)) {
-                    line = internal::trim(line);
-                    
-                    if (!line.empty() && line[0] != '#') {
-                        if (internal::parse_value(line, value)) {
-                            value_read = true;
-                            parsed = true;
-                            std::lock_guard<std::mutex> lock(mtx_);
-                            last_error_ = ErrorInfo(); // Clear error on success
-                            break;
-                        }
-                    }
-                }
-                if (!parsed) {
-                    std::lock_guard<std::mutex> lock(mtx_);
-                    last_error_ = ErrorInfo(ErrorType::ParseError,
-                                          "No valid value found in file",
-                                          input_path);
-                    internal::log(LogLevel::Debug, last_error_.to_string());
-                }
-            } else {
-                std::lock_guard<std::mutex> lock(mtx_);
-                last_error_ = read_error;
+        std::lock_guard<std::mutex> lock(mtx_);
+        bindings_.apply_defaults();
+    }
+
+    /**
+     * @brief Get list of bound parameter names
+     * 
+     * @note Lock-free unless bindings changed since the last call.
+     */
+    std::vector<std::string> get_bound_names() const {
+        if (bound_names_dirty_.load()) {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (bound_names_dirty_.load()) {
+                auto names = std::make_unique<std::vector<std::string>>();
+                names->reserve(bindings_.size());
+                bindings_.for_each_slot([&](uint32_t slot) {
+                    names->push_back(slot_keys_[slot]);
+                });
+                bound_names_.publish(std::move(names));
+                bound_names_dirty_.store(false);
             }
-            
-            if (!value_read) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        return *bound_names_.read();
+    }
+
+private:
+    void invalidate_cache_unlocked() {
+        file_cache_ = FileCache{};
+        change_detector_.reset();
+        file_changed_.store(true);  // Force the next update() past the idle fast path
+        // Bindings keep their values until the next load: finish pending work
+        // against the values being discarded, and report it with that load
+        notify_pending_ = apply_queued(std::nullopt, nullptr);
+        full_apply_pending_ = true;
+        content_hash_.reset();
+        const uint64_t next_version = snapshot_.read()->version + 1;
+        publish_values(std::make_shared<internal::ValueSnapshot::ValueMap>(), next_version);
+        sync_parse_base();
+    }
+
+    /**
+     * @brief Publish a value map with a slot table for every resolved key
+     * 
+     * @return The published snapshot (valid until the next publish under mtx_)
+     */
+    const internal::ValueSnapshot* publish_values(
+        std::shared_ptr<const internal::ValueSnapshot::ValueMap> values, uint64_t version) {
+        auto next = std::make_unique<internal::ValueSnapshot>();
+        next->slots.resize(slot_keys_.size(), nullptr);
+        for (size_t slot = 0; slot < slot_keys_.size(); ++slot) {
+            auto it = values->find(slot_keys_[slot]);
+            if (it != values->end()) {
+                next->slots[slot] = &it->second;
             }
         }
+        next->values = std::move(values);
+        next->version = version;
+        const internal::ValueSnapshot* published = next.get();
+        snapshot_.publish(std::move(next));
+        return published;
     }
 
-    template<typename T>
-    bool get_timeout_event_driven(T& value, const std::string& input_path, 
-                                  std::chrono::milliseconds timeout) {
-        auto watcher = std::make_unique<internal::FileWatcher>(file_watcher_config_);
-        std::atomic<bool> file_changed{true};
+    /**
+     * @brief Map a name to its stable slot index
+     * 
+     * New slots are covered by the slot table from the next publish.
+     */
+    uint32_t resolve_slot(const std::string& name) {
+        auto it = key_slots_.find(name);
+        if (it != key_slots_.end()) {
+            return it->second;
+        }
         
-        if (!watcher->start(input_path, [&file_changed] {
-            file_changed.store(true);
-        })) {
+        uint32_t slot = static_cast<uint32_t>(slot_keys_.size());
+        key_slots_.emplace(name, slot);
+        slot_keys_.push_back(name);
+        return slot;
+    }
+
+    /**
+     * @brief Republish the current values with a slot table covering every key
+     */
+    void republish_slots() {
+        std::shared_ptr<const internal::ValueSnapshot::ValueMap> values;
+        uint64_t version = 0;
+        {
+            auto current = snapshot_.read();
+            values = current->values;
+            version = current->version;
+        }
+        publish_values(std::move(values), version);
+    }
+
+    void ensure_file_exists() {
+        if (!std::filesystem::exists(file_path_)) {
+            std::ofstream file(file_path_);
+            if (file) {
+                switch (format_) {
+                case FileFormat::Json:
+                    file << "{\n";
+                    file << "  // Live Tuner parameters\n";
+                    file << "  // Edit values here and save\n";
+                    file << "}\n";
+                    break;
+                case FileFormat::Yaml:
+                    file << "# Live Tuner parameters\n";
+                    file << "# Edit values here and save\n";
+                    file << "---\n";
+                    break;
+                default:
+                    file << "# Live Tuner parameters\n";
+                    file << "# Format: key = value\n";
+                    file << "\n";
+                    break;
+                }
+            }
+        }
+    }
+
+    bool load_file() {
+        // Read file with retry logic
+        ErrorInfo read_error;
+        const bool read = file_read_retry_config_.deferred
+            ? internal::try_read_file(file_path_, file_read_retry_config_, file_reader_, read_retry_, &read_error)
+            : internal::read_file_with_retry(file_path_, file_read_retry_config_, file_reader_, &read_error);
+        if (!read) {
+            last_error_ = read_error;
+            return false;
+        }
+        
+        const std::string_view content = file_reader_.view();
+        
+        // Same bytes as the last accepted contents: nothing can have changed
+        const uint64_t content_hash = internal::hash_content(content);
+        if (content_hash_ == content_hash) {
+            ++skipped_parse_count_;
+            last_error_ = ErrorInfo();
+            return false;
+        }
+        
+        std::unordered_map<std::string, std::string> new_values;
+        if (!parse_content(format_, file_path_, content, new_values, last_error_)) {
+            return false;
+        }
+        content_hash_ = content_hash;
+        
+        uint64_t next_version = 0;
+        std::vector<std::string> changed;
+        auto values = std::make_shared<internal::ValueSnapshot::ValueMap>();
+        {
+            auto current = snapshot_.read();
+            next_version = current->version + 1;
+            diff_values(*current->values, new_values, *values, changed);
+        }
+        
+        if (changed.empty()) {
+            sync_parse_base();  // New hash
+            return false;
+        }
+        return commit_values(std::move(values), next_version, std::move(changed));
+    }
+    
+    /**
+     * @brief Parse file contents into key -> text
+     * @return false (with error set and logged) if nothing could be parsed
+     */
+    static bool parse_content(FileFormat format, const std::string& path, std::string_view content,
+                              std::unordered_map<std::string, std::string>& new_values,
+                              ErrorInfo& error) {
+        bool parsed = false;
+        const char* message = nullptr;
+        
+        switch (format) {
+        case FileFormat::Json:
+            parsed = internal::PicojsonParser::parse(content, new_values);
+            message = "Failed to parse JSON format";
+            break;
+        case FileFormat::Yaml:
+            parsed = internal::SimpleKeyValueParser::parse(content, new_values, true);
+            message = "Failed to parse YAML format";
+            break;
+        case FileFormat::KeyValue:
+        case FileFormat::Plain:
+        default:
+            parsed = internal::SimpleKeyValueParser::parse(content, new_values, false);
+            message = "Failed to parse key-value format";
+            break;
+        }
+        
+        if (!parsed && new_values.empty()) {
+            error = ErrorInfo(ErrorType::ParseError, message, path);
+            internal::log(LogLevel::Error, error.to_string());
+            return false;
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Diff parsed texts per key against published values
+     * 
+     * Unchanged values are copied over as-is; only changed ones are
+     * converted again. `changed` receives added, changed and removed keys.
+     */
+    static void diff_values(const internal::ValueSnapshot::ValueMap& current_values,
+                            std::unordered_map<std::string, std::string>& new_values,
+                            internal::ValueSnapshot::ValueMap& values,
+                            std::vector<std::string>& changed) {
+        values.reserve(new_values.size());
+        for (auto& [key, text] : new_values) {
+            auto it = current_values.find(key);
+            if (it != current_values.end() && it->second.text == text) {
+                values.emplace(key, it->second);
+            } else {
+                changed.push_back(key);
+                values.emplace(key, internal::ParamValue(std::move(text)));
+            }
+        }
+        for (const auto& [key, _] : current_values) {
+            if (new_values.find(key) == new_values.end()) {
+                changed.push_back(key);  // Removed
+            }
+        }
+    }
+    
+    /**
+     * @brief Publish diffed values and queue the changed bindings
+     */
+    bool commit_values(std::shared_ptr<internal::ValueSnapshot::ValueMap> values,
+                       uint64_t version, std::vector<std::string> changed) {
+        // Publish the new snapshot with one swap
+        publish_values(std::move(values), version);
+        
+        // Queue bound variables: only the changed keys, unless the previous
+        // values were discarded and every binding has to be re-applied
+        if (full_apply_pending_) {
+            apply_all_queued_ = true;
+            full_apply_pending_ = false;
+        } else if (!apply_all_queued_) {
+            for (const auto& key : changed) {
+                auto it = key_slots_.find(key);
+                if (it != key_slots_.end()) {
+                    queue_slot(it->second);
+                }
+            }
+        }
+        notify_pending_ = true;
+        apply_pending_.store(true, std::memory_order_release);
+        
+        std::sort(changed.begin(), changed.end());
+        changed_keys_ = std::move(changed);
+        sync_parse_base();
+        
+        // Clear error on success
+        last_error_ = ErrorInfo();
+        return true;
+    }
+    
+    /**
+     * @brief Commit the worker's prepared load (background parse, under mtx_)
+     */
+    void commit_prepared() {
+        std::optional<PreparedLoad> prepared;
+        {
+            std::lock_guard<std::mutex> channel_lock(parse_channel_->mtx);
+            prepared.swap(parse_channel_->prepared);
+            parse_channel_->ready.store(false, std::memory_order_relaxed);
+        }
+        if (!prepared) {
+            return;
+        }
+        if (prepared->failed) {
+            last_error_ = prepared->error;
+            return;
+        }
+        if (prepared->same_content) {
+            ++skipped_parse_count_;
+            last_error_ = ErrorInfo();
+            return;
+        }
+        
+        const uint64_t version = snapshot_.read()->version;
+        if (prepared->base_version != version) {
+            // Published since the worker took its base (update(), invalidate_cache())
+            sync_parse_base();
+            parse_channel_->request();
+            return;
+        }
+        content_hash_ = prepared->content_hash;
+        if (prepared->changed.empty()) {
+            sync_parse_base();
+            return;
+        }
+        commit_values(std::move(prepared->values), version + 1, std::move(prepared->changed));
+    }
+    
+    /**
+     * @brief Load if changed, then assign queued bindings until the deadline
+     */
+    PollProgress poll_until(std::optional<std::chrono::steady_clock::time_point> deadline) {
+        PollProgress progress;
+        // The parse channel is only read under mtx_: stop_watching() may release it
+        if (!parse_active_.load(std::memory_order_acquire) &&
+            !file_changed_.load(std::memory_order_acquire) &&
+            !apply_pending_.load(std::memory_order_acquire)) {
+            return progress;
+        }
+        if (in_callback_.load()) {
+            return progress;
+        }
+        
+        std::function<void()> callback_to_invoke;
+        {
             std::lock_guard<std::mutex> lock(mtx_);
-            last_error_ = ErrorInfo(ErrorType::WatcherError,
-                                  "Failed to start file watcher, falling back to polling mode",
-                                  input_path);
-            internal::log(LogLevel::Warning, last_error_.to_string());
-            internal::log(LogLevel::Info, 
-                "LiveTuner: Event-driven file watching failed for '" + input_path + "'. "
-                "Falling back to polling mode with timeout. "
-                "This may occur due to: OS watcher resource limits, unsupported filesystem, "
-                "or permission issues.");
-            return get_timeout_polling(value, input_path, timeout);
+            if (parse_channel_) {
+                // invalidate_cache() asks for a fresh load
+                if (file_changed_.exchange(false)) {
+                    parse_channel_->request();
+                }
+                if (parse_channel_->ready.load(std::memory_order_acquire)) {
+                    commit_prepared();
+                }
+            } else if (file_changed_.load()) {
+                reload_if_changed();
+            }
+            progress.updated = apply_queued(deadline, &progress.applied);
+            progress.pending = queued_bindings();
+            if (progress.updated && on_change_callback_) {
+                callback_to_invoke = on_change_callback_;
+            }
         }
         
-        auto start_time = std::chrono::steady_clock::now();
+        run_change_callback(callback_to_invoke);
+        return progress;
+    }
+    
+    /**
+     * @brief Load the file if it changed (under mtx_); bindings are only queued
+     */
+    void reload_if_changed() {
+        // A reported change bypasses the modification-time cache
+        bool change_reported = file_changed_.exchange(false);
         
-        while (true) {
-            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::steady_clock::now() - start_time
-            );
-            
-            if (elapsed >= timeout) {
-                watcher->stop();
-                std::lock_guard<std::mutex> lock(mtx_);
-                last_error_ = ErrorInfo(ErrorType::Timeout,
-                                      "Timeout waiting for valid value",
-                                      input_path);
-                internal::log(LogLevel::Warning, last_error_.to_string());
-                return false;
+        auto now = std::chrono::steady_clock::now();
+        if (read_retry_.pending()) {
+            if (read_retry_.waiting(now)) {
+                file_changed_.store(true);  // Keep poll()/the idle fast path coming back
+                return;
             }
-            
-            if (file_changed.load()) {
-                file_changed.store(false);
-                
-                if (try_get(value)) {
-                    watcher->stop();
-                    return true;
+            change_reported = true;  // Deferred retry is due
+        }
+        
+        if (file_cache_.file_missing && now < file_cache_.missing_until) {
+            return;
+        }
+        
+        using Change = internal::FileChangeDetector::Result;
+        auto change = change_detector_.check(file_path_);
+        if (change == Change::Missing) {
+            ensure_file_exists();
+            change = change_detector_.check(file_path_);
+            if (change == Change::Missing) {
+                if (!file_cache_.file_missing) {
+                    last_error_ = ErrorInfo(ErrorType::FileNotFound,
+                                           "File does not exist and could not be created", file_path_);
+                    internal::log(LogLevel::Warning, last_error_.to_string());
                 }
+                file_cache_.file_missing = true;
+                file_cache_.missing_until = now + FileCache::missing_retry_interval;
+                return;
             }
-            
-            auto remaining = timeout - elapsed;
-            watcher->wait_for_change(std::min(remaining, std::chrono::milliseconds(100)));
         }
+        file_cache_.file_missing = false;
+        
+        if (!change_reported && file_cache_.file_exists && change == Change::Unchanged) {
+            return;
+        }
+        
+        load_file();
+        if (read_retry_.pending()) {
+            file_changed_.store(true);
+        }
+        
+        file_cache_.file_exists = true;
     }
     
-    template<typename T>
-    bool get_timeout_polling(T& value, const std::string& input_path,
-                             std::chrono::milliseconds timeout) {
-        auto start_time = std::chrono::steady_clock::now();
+    void queue_slot(uint32_t slot) {
+        if (slot >= slot_queued_.size()) {
+            slot_queued_.resize(slot_keys_.size());
+        }
+        if (!slot_queued_[slot]) {
+            slot_queued_[slot] = true;
+            pending_slots_.push_back(slot);
+        }
+    }
+    
+    size_t queued_bindings() const {
+        return apply_all_queued_ ? bindings_.size() : pending_slots_.size() - pending_pos_;
+    }
+    
+    /**
+     * @brief Assign queued bindings from the published values (under mtx_)
+     * 
+     * Without a deadline everything is assigned (all bindings with one sweep
+     * per segment). With one, batches of bind_batch_size are assigned until
+     * it passes.
+     * 
+     * @return true if the queue drained after a reload (run the change callback)
+     */
+    bool apply_queued(std::optional<std::chrono::steady_clock::time_point> deadline, size_t* applied) {
+        if (!apply_pending_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        auto current = snapshot_.read();
+        size_t count = 0;
         
-        while (true) {
-            auto elapsed = std::chrono::steady_clock::now() - start_time;
-            if (elapsed >= timeout) {
-                std::lock_guard<std::mutex> lock(mtx_);
-                last_error_ = ErrorInfo(ErrorType::Timeout,
-                                      "Timeout waiting for valid value",
-                                      input_path);
-                internal::log(LogLevel::Warning, last_error_.to_string());
-                return false;
+        if (apply_all_queued_) {
+            apply_all_queued_ = false;
+            if (!deadline) {
+                bindings_.apply(*current, slot_keys_);
+                count = bindings_.size();
+                for (size_t i = pending_pos_; i < pending_slots_.size(); ++i) {
+                    slot_queued_[pending_slots_[i]] = false;
+                }
+                pending_slots_.clear();
+                pending_pos_ = 0;
+            } else {
+                bindings_.for_each_slot([this](uint32_t slot) { queue_slot(slot); });
+            }
+        }
+        
+        while (pending_pos_ < pending_slots_.size()) {
+            const size_t end = deadline ? std::min(pending_pos_ + bind_batch_size, pending_slots_.size())
+                                        : pending_slots_.size();
+            for (; pending_pos_ < end; ++pending_pos_) {
+                const uint32_t slot = pending_slots_[pending_pos_];
+                slot_queued_[slot] = false;
+                if (bindings_.apply_slot(slot, *current, slot_keys_)) {
+                    ++count;
+                }
+            }
+            if (deadline && pending_pos_ < pending_slots_.size() &&
+                std::chrono::steady_clock::now() >= *deadline) {
+                break;
+            }
+        }
+        if (applied) {
+            *applied = count;
+        }
+        if (pending_pos_ < pending_slots_.size()) {
+            return false;
+        }
+        
+        pending_slots_.clear();
+        pending_pos_ = 0;
+        apply_pending_.store(false, std::memory_order_release);
+        const bool notify = notify_pending_;
+        notify_pending_ = false;
+        return notify;
+    }
+    
+    /**
+     * @brief Hand the published state to the parse worker as its diff base (under mtx_)
+     */
+    void sync_parse_base() {
+        if (!parse_channel_) {
+            return;
+        }
+        std::shared_ptr<const internal::ValueSnapshot::ValueMap> values;
+        uint64_t version = 0;
+        {
+            auto current = snapshot_.read();
+            values = current->values;
+            version = current->version;
+        }
+        std::lock_guard<std::mutex> lock(parse_channel_->mtx);
+        parse_channel_->base = std::move(values);
+        parse_channel_->base_version = version;
+        parse_channel_->base_hash = content_hash_;
+    }
+    
+    /**
+     * @brief Stop the background parse worker and wait for it
+     */
+    static void stop_parse_worker(const std::shared_ptr<ParseChannel>& channel, std::thread& worker) {
+        if (channel) {
+            {
+                std::lock_guard<std::mutex> lock(channel->mtx);
+                channel->stop = true;
+            }
+            channel->cv.notify_one();
+        }
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    
+    /**
+     * @brief Background parse worker: read, hash, parse and diff on request
+     */
+    static void run_parse_worker(std::shared_ptr<ParseChannel> channel) {
+        internal::FileReader reader;
+        for (;;) {
+            std::string path;
+            FileFormat format = FileFormat::Auto;
+            internal::FileReadRetryConfig retry;
+            std::shared_ptr<const internal::ValueSnapshot::ValueMap> base;
+            std::optional<uint64_t> base_hash;
+            PreparedLoad prepared;
+            {
+                std::unique_lock<std::mutex> lock(channel->mtx);
+                channel->cv.wait(lock, [&] { return channel->requested || channel->stop; });
+                if (channel->stop) {
+                    return;
+                }
+                channel->requested = false;
+                path = channel->path;
+                format = channel->format;
+                retry = channel->retry;
+                base = channel->base;
+                base_hash = channel->base_hash;
+                prepared.base_version = channel->base_version;
             }
             
-            if (try_get(value)) {
-                return true;
+            if (!internal::read_file_with_retry(path, retry, reader, &prepared.error)) {
+                prepared.failed = true;
+            } else {
+                const std::string_view content = reader.view();
+                prepared.content_hash = internal::hash_content(content);
+                std::unordered_map<std::string, std::string> new_values;
+                if (base_hash == prepared.content_hash) {
+                    prepared.same_content = true;
+                } else if (!parse_content(format, path, content, new_values, prepared.error)) {
+                    prepared.failed = true;
+                } else {
+                    prepared.values = std::make_shared<internal::ValueSnapshot::ValueMap>();
+                    diff_values(*base, new_values, *prepared.values, prepared.changed);
+                }
             }
             
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            {
+                std::lock_guard<std::mutex> lock(channel->mtx);
+                channel->prepared = std::move(prepared);
+            }
+            channel->ready.store(true, std::memory_order_release);
+        }
+    }
+    
+    /**
+     * @brief Run the change callback outside mtx_, guarded against reentrancy
+     */
+    void run_change_callback(const std::function<void()>& callback) {
+        if (!callback) {
+            return;
+        }
+        in_callback_.store(true);
+        try {
+            callback();
+        } catch (...) {
+            in_callback_.store(false);
+            throw;
         }
+        in_callback_.store(false);
     }
 };
 
-// ============================================================
-// Dependency Injection Support (Testable Design)
-// ============================================================
-
 /**
- * @brief RAII context for LiveTuner
+ * @brief Pre-resolved parameter accessor
  * 
- * Avoids global state in tests and large applications.
- * Automatically cleans up when leaving scope.
+ * Obtained from Params::handle<T>(). Reads are lock-free and skip the
+ * name lookup entirely; see Params::handle() for lifetime rules.
  */
-class ScopedTunerContext {
+template<typename T>
+class ParamHandle {
 public:
-    explicit ScopedTunerContext(std::string_view file_path = "params.txt")
-        : tuner_(std::make_unique<LiveTuner>(file_path)) {}
+    ParamHandle() = default;
     
-    ~ScopedTunerContext() = default;
+    /**
+     * @brief Get current value (nullopt if missing or not convertible)
+     */
+    std::optional<T> get() const {
+        if (!params_) return std::nullopt;
+        auto snapshot = params_->snapshot_.read();
+        if (slot_ < snapshot->slots.size()) {
+            if (const auto* source = snapshot->slots[slot_]) {
+                T value;
+                if (internal::convert_value(*source, value)) {
+                    return value;
+                }
+            }
+        }
+        return std::nullopt;
+    }
     
-    ScopedTunerContext(const ScopedTunerContext&) = delete;
-    ScopedTunerContext& operator=(const ScopedTunerContext&) = delete;
-    ScopedTunerContext(ScopedTunerContext&&) = default;
-    ScopedTunerContext& operator=(ScopedTunerContext&&) = default;
+    /**
+     * @brief Get current value (with default)
+     */
+    T get_or(T default_value) const {
+        auto val = get();
+        return val ? std::move(*val) : std::move(default_value);
+    }
     
-    LiveTuner& tuner() { return *tuner_; }
-    const LiveTuner& tuner() const { return *tuner_; }
+    /**
+     * @brief Check if the parameter is present in the current values
+     */
+    bool exists() const {
+        if (!params_) return false;
+        auto snapshot = params_->snapshot_.read();
+        return slot_ < snapshot->slots.size() && snapshot->slots[slot_] != nullptr;
+    }
     
+    /**
+     * @brief Check if the handle was obtained from a Params object
+     */
+    explicit operator bool() const { return params_ != nullptr; }
+
 private:
-    std::unique_ptr<LiveTuner> tuner_;
+    friend class Params;
+    ParamHandle(const Params* params, uint32_t slot) : params_(params), slot_(slot) {}
+    
+    const Params* params_ = nullptr;
+    uint32_t slot_ = 0;
 };
 
+// ============================================================
+// LiveTuner Class
+// ============================================================
+
 /**
- * @brief RAII context for Params
+ * @brief Live parameter tuning (Low-level API)
+ * 
+ * @warning Event-driven callbacks run on background thread.
+ * Not safe for OpenGL/DirectX. Use Params class for main-thread execution.
  */
-class ScopedParamsContext {
+class LiveTuner {
 public:
-    explicit ScopedParamsContext(std::string_view file_path = "params.json",
-                                  FileFormat format = FileFormat::Auto)
-        : params_(std::make_unique<Params>(file_path, format)) {}
+    struct FileCache {
+        bool file_exists = false;
+    };
+
+private:
+    mutable std::mutex mtx_;
+    std::string input_file_path_ = "params.txt";
+    FileCache file_cache_;
+    internal::FileChangeDetector change_detector_;
+    std::unique_ptr<internal::FileWatcher> file_watcher_;  // Started lazily by blocking reads
+    std::string watched_path_;
+    internal::FileWatcherConfig file_watcher_config_;
+    internal::FileReadRetryConfig file_read_retry_config_;
+    internal::DeferredRetry read_retry_;
+    bool use_event_driven_ = true;
+    
+    // Bumped by the watcher on every reported change; blocking readers wait on it
+    std::mutex change_mtx_;
+    std::condition_variable change_cv_;
+    uint64_t change_generation_ = 0;
+    
+    // Error information
+    ErrorInfo last_error_;
+
+public:
+    LiveTuner() = default;
+    
+    explicit LiveTuner(std::string_view file_path) : input_file_path_(file_path) {}
+    
+    /**
+     * @brief Get file read retry configuration
+     */
+    const internal::FileReadRetryConfig& get_read_retry_config() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return file_read_retry_config_;
+    }
+    
+    /**
+     * @brief Set file read retry configuration
+     * 
+     * Avoids conflicts while editor is writing (especially on Windows).
+     */
+    void set_read_retry_config(const internal::FileReadRetryConfig& config) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        file_read_retry_config_ = config;
+    }
+    
+    LiveTuner(const LiveTuner&) = delete;
+    LiveTuner& operator=(const LiveTuner&) = delete;
+    LiveTuner(LiveTuner&&) noexcept;
+    LiveTuner& operator=(LiveTuner&&) noexcept;
+    
+    ~LiveTuner();
+
+    /**
+     * @brief Set file path to monitor
+     */
+    void set_file(std::string_view file_path) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        input_file_path_ = file_path;
+        invalidate_cache();
+        stop_watcher();
+    }
+    
+    std::string get_file() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return input_file_path_;
+    }
+
+    /**
+     * @brief Get file watcher configuration
+     */
+    const internal::FileWatcherConfig& get_watcher_config() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return file_watcher_config_;
+    }
+    
+    /**
+     * @brief Set file watcher configuration
+     */
+    void set_watcher_config(const internal::FileWatcherConfig& config) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        file_watcher_config_ = config;
+        file_watcher_config_.validate();
+        stop_watcher();  // Restarted with the new configuration on next use
+    }
+
+    /**
+     * @brief Enable/disable event-driven mode
+     */
+    void set_event_driven(bool enabled) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        use_event_driven_ = enabled;
+        stop_watcher();
+    }
+    
+    bool is_event_driven() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return use_event_driven_;
+    }
+    
+    static bool has_native_file_watch() {
+        return internal::FileWatcher::has_native_support();
+    }
+
+    /**
+     * @brief Get last error information
+     */
+    ErrorInfo last_error() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return last_error_;
+    }
+    
+    /**
+     * @brief Check if there is an error
+     */
+    bool has_error() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return static_cast<bool>(last_error_);
+    }
+    
+    /**
+     * @brief Clear error
+     */
+    void clear_error() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        last_error_ = ErrorInfo();
+    }
+
+    /**
+     * @brief Try to read value immediately (non-blocking)
+     * 
+     * Updates value only when file has changed.
+     * Optimal for game loops and frequent calls.
+     * Built-in retry logic to avoid file write conflicts with editors.
+     * 
+     * @param value Variable to store read value
+     * @return true if value was updated
+     * 
+     * @note Thread-safe: This method can be safely called from multiple threads.
+     *       The file cache is protected by mutex to prevent data races.
+     */
+    template<typename T>
+    bool try_get(T& value) {
+        std::string input_path;
+        internal::FileReadRetryConfig retry_config;
+        
+        auto now = std::chrono::steady_clock::now();
+        
+        // Phase 1: Check cache and get configuration (locked)
+        internal::DeferredRetry retry;
+        bool retry_due = false;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            input_path = input_file_path_;
+            retry_config = file_read_retry_config_;
+            retry = read_retry_;
+            if (retry_config.deferred && retry.pending()) {
+                if (retry.waiting(now)) {
+                    return false;
+                }
+                retry_due = true;
+            }
+        }
+        
+        ensure_file_exists(input_path);
+        
+        // Phase 2: Check the held file for changes (locked; one fstat)
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            auto change = change_detector_.check(input_path);
+            if (!retry_due && file_cache_.file_exists &&
+                change == internal::FileChangeDetector::Result::Unchanged) {
+                return false;
+            }
+        }
+        
+        // Phase 3: Read file (unlocked - I/O operation)
+        ErrorInfo read_error;
+        std::optional<std::string> content_opt;
+        if (retry_config.deferred) {
+            internal::FileReader reader;
+            if (internal::try_read_file(input_path, retry_config, reader, retry, &read_error)) {
+                content_opt = reader.take();
+            }
+            std::lock_guard<std::mutex> lock(mtx_);
+            read_retry_ = retry;
+        } else {
+            content_opt = internal::read_file_with_retry(input_path, retry_config, &read_error);
+        }
+        if (!content_opt) {
+            std::lock_guard<std::mutex> lock(mtx_);
+            last_error_ = read_error;
+            file_cache_.file_exists = false;
+            return false;
+        }
+        
+        // Phase 4: Parse content (unlocked - CPU operation)
+        std::istringstream stream(*content_opt);
+        std::string line;
+        bool value_found = false;
+        T parsed_value{};
+        std::string failed_line;
+        bool parse_error = false;
+        
+        while (std::getline(stream, line)) {
+            line = internal::trim(line);
+            
+            if (!line.empty() && line[0] != '#') {
+                if (internal::parse_value(line, parsed_value)) {
+                    value_found = true;
+                    break;
+                } else {
+                    // Parse failure - save for error reporting
+                    failed_line = line;
+                    parse_error = true;
+                }
+            }
+        }
+        
+        // Phase 5: Update cache and state (locked)
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            
+            if (value_found) {
+                // On success, clear error and update cache
+                value = std::move(parsed_value);
+                file_cache_.file_exists = true;
+                last_error_ = ErrorInfo();
+                return true;
+            }
+            
+            if (parse_error) {
+                last_error_ = ErrorInfo(ErrorType::ParseError,
+                                      "Failed to parse value from line: '" + failed_line + "'",
+                                      input_path);
+                internal::log(LogLevel::Warning, last_error_.to_string());
+            } else {
+                last_error_ = ErrorInfo(ErrorType::ParseError,
+                                      "No valid value found in file",
+                                      input_path);
+                internal::log(LogLevel::Debug, last_error_.to_string());
+            }
+            
+            file_cache_.file_exists = true;
+        }
+        
+        return false;
+    }
+
+    /**
+     * @brief Block until value is read
+     */
+    template<typename T>
+    void get(T& value) {
+        std::string input_path;
+        bool event_driven;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            input_path = input_file_path_;
+            event_driven = use_event_driven_;
+        }
+        
+        ensure_file_exists(input_path);
+        
+        if (event_driven) {
+            get_event_driven(value, input_path);
+        } else {
+            get_polling(value, input_path);
+        }
+    }
+
+    /**
+     * @brief Read value with timeout
+     */
+    template<typename T>
+    bool get_timeout(T& value, std::chrono::milliseconds timeout) {
+        std::string input_path;
+        bool event_driven;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            input_path = input_file_path_;
+            event_driven = use_event_driven_;
+        }
+        
+        ensure_file_exists(input_path);
+        
+        if (event_driven) {
+            return get_timeout_event_driven(value, input_path, timeout);
+        } else {
+            return get_timeout_polling(value, input_path, timeout);
+        }
+    }
+
+    /**
+     * @brief Read value asynchronously (future version)
+     */
+    template<typename T>
+    std::future<T> get_async() {
+        return std::async(std::launch::async, [this]() {
+            T value{};
+            get(value);
+            return value;
+        });
+    }
+
+    /**
+     * @brief Read value asynchronously (callback version)
+     */
+    template<typename T, typename Callback>
+    void get_async(Callback callback) {
+        std::thread([this, callback = std::move(callback)]() {
+            T value{};
+            get(value);
+            callback(value);
+        }).detach();
+    }
+
+    /**
+     * @brief Invalidate cache
+     */
+    void invalidate_cache() {
+        file_cache_ = FileCache{};
+        change_detector_.reset();
+    }
+
+    /**
+     * @brief Reset state (clear cache)
+     */
+    void reset() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        // Don't reset file path (maintain path set by set_file)
+        stop_watcher();
+        invalidate_cache();
+    }
+
+private:
+    /**
+     * @brief Start the long-lived watcher for a path if not running (locked by caller)
+     * 
+     * Shared by every blocking read until the path, configuration or
+     * event-driven mode changes.
+     */
+    bool ensure_watcher(const std::string& input_path) {
+        if (!use_event_driven_) {
+            return false;
+        }
+        if (file_watcher_ && file_watcher_->is_running() && watched_path_ == input_path) {
+            return true;
+        }
+        
+        stop_watcher();
+        auto watcher = std::make_unique<internal::FileWatcher>(file_watcher_config_);
+        if (!watcher->start(input_path, [this] {
+            {
+                std::lock_guard<std::mutex> lock(change_mtx_);
+                ++change_generation_;
+            }
+            change_cv_.notify_all();
+        })) {
+            return false;
+        }
+        file_watcher_ = std::move(watcher);
+        watched_path_ = input_path;
+        return true;
+    }
+    
+    void stop_watcher() {
+        if (file_watcher_) {
+            file_watcher_->stop();
+            file_watcher_.reset();
+        }
+        watched_path_.clear();
+    }
+    
+    uint64_t change_generation() {
+        std::lock_guard<std::mutex> lock(change_mtx_);
+        return change_generation_;
+    }
+    
+    /**
+     * @brief Wait until the change generation moves past `last_seen`
+     * @return true (and updates last_seen) if a change was reported
+     */
+    bool wait_for_change(uint64_t& last_seen, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(change_mtx_);
+        if (!change_cv_.wait_for(lock, timeout, [&] { return change_generation_ != last_seen; })) {
+            return false;
+        }
+        last_seen = change_generation_;
+        return true;
+    }
+
+    void ensure_file_exists(const std::string& path) {
+        if (!std::filesystem::exists(path)) {
+            std::ofstream file(path);
+            if (file) {
+                file << "# Live Tuner parameters (edit values here)\n";
+                file << "# Lines starting with # are comments\n";
+            }
+        }
+    }
+
+    template<typename T>
+    void get_event_driven(T& value, const std::string& input_path) {
+        internal::FileReadRetryConfig retry_config;
+        bool watching = false;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            retry_config = file_read_retry_config_;
+            watching = ensure_watcher(input_path);
+        }
+        
+        if (!watching) {
+            std::lock_guard<std::mutex> lock(mtx_);
+            last_error_ = ErrorInfo(ErrorType::WatcherError,
+                                  "Failed to start file watcher, falling back to polling mode",
+                                  input_path);
+            internal::log(LogLevel::Warning, last_error_.to_string());
+            internal::log(LogLevel::Info, 
+                "LiveTuner: Event-driven file watching failed for '" + input_path + "'. "
+                "Falling back to polling mode (100ms interval). "
+                "This may occur due to: OS watcher resource limits, unsupported filesystem, "
+                "or permission issues. Performance may be slightly reduced.");
+            get_polling(value, input_path);
+            return;
+        }
+        
+        // Seen before reading, so a change during the read is not missed
+        uint64_t seen = change_generation();
+        bool file_changed = true;
+        bool value_read = false;
+        while (!value_read) {
+            if (file_changed) {
+                file_changed = false;
+                
+                // Read file with retry logic
+                ErrorInfo read_error;
+                auto content_opt = internal::read_file_with_retry(input_path, retry_config, &read_error);
+                if (content_opt) {
+                    std::istringstream stream(*content_opt);
+                    std::string line;
+                    bool parsed = false;
+                    while (std::getline(stream, line)) {
+                        line = internal::trim(line);
+                        
+                        if (!line.empty() && line[0] != '#') {
+                            if (internal::parse_value(line, value)) {
+                                value_read = true;
+                                parsed = true;
+                                std::lock_guard<std::mutex> lock(mtx_);
+                                last_error_ = ErrorInfo(); // Clear error on success
+                                break;
+                            }
+                        }
+                    }
+                    if (!parsed) {
+                        std::lock_guard<std::mutex> lock(mtx_);
+                        last_error_ = ErrorInfo(ErrorType::ParseError,
+                                              "No valid value found in file",
+                                              input_path);
+                        internal::log(LogLevel::Debug, last_error_.to_string());
+                    }
+                } else {
+                    std::lock_guard<std::mutex> lock(mtx_);
+                    last_error_ = read_error;
+                }
+            }
+            
+            if (!value_read) {
+                file_changed = wait_for_change(seen, std::chrono::milliseconds(1000));
+            }
+        }
+    }
+    
+    template<typename T>
+    void get_polling(T& value, const std::string& input_path) {
+        internal::FileReadRetryConfig retry_config;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            retry_config = file_read_retry_config_;
+        }
+        
+        bool value_read = false;
+        
+        while (!value_read) {
+            // Read file with retry logic
+            ErrorInfo read_error;
+            auto content_opt = internal::read_file_with_retry(input_path, retry_config, &read_error);
+            if (content_opt) {
+                std::istringstream stream(*content_opt);
+                std::string line;
+                bool parsed = false;
+                while (std::getline(stream, line)) {
+                    line = internal::trim(line);
+                    
+                    if (!line.empty() && line[0] != '#') {
+                        if (internal::parse_value(line, value)) {
+                            value_read = true;
+                            parsed = true;
+                            std::lock_guard<std::mutex> lock(mtx_);
+                            last_error_ = ErrorInfo(); // Clear error on success
+                            break;
+                        }
+                    }
+                }
+                if (!parsed) {
+                    std::lock_guard<std::mutex> lock(mtx_);
+                    last_error_ = ErrorInfo(ErrorType::ParseError,
+                                          "No valid value found in file",
+                                          input_path);
+                    internal::log(LogLevel::Debug, last_error_.to_string());
+                }
+            } else {
+                std::lock_guard<std::mutex> lock(mtx_);
+                last_error_ = read_error;
+            }
+            
+            if (!value_read) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+    }
+
+    template<typename T>
+    bool get_timeout_event_driven(T& value, const std::string& input_path, 
+                                  std::chrono::milliseconds timeout) {
+        bool watching = false;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            watching = ensure_watcher(input_path);
+        }
+        
+        if (!watching) {
+            std::lock_guard<std::mutex> lock(mtx_);
+            last_error_ = ErrorInfo(ErrorType::WatcherError,
+                                  "Failed to start file watcher, falling back to polling mode",
+                                  input_path);
+            internal::log(LogLevel::Warning, last_error_.to_string());
+            internal::log(LogLevel::Info, 
+                "LiveTuner: Event-driven file watching failed for '" + input_path + "'. "
+                "Falling back to polling mode with timeout. "
+                "This may occur due to: OS watcher resource limits, unsupported filesystem, "
+                "or permission issues.");
+            return get_timeout_polling(value, input_path, timeout);
+        }
+        
+        auto start_time = std::chrono::steady_clock::now();
+        uint64_t seen = change_generation();
+        bool file_changed = true;
+        
+        while (true) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start_time
+            );
+            
+            if (elapsed >= timeout) {
+                std::lock_guard<std::mutex> lock(mtx_);
+                last_error_ = ErrorInfo(ErrorType::Timeout,
+                                      "Timeout waiting for valid value",
+                                      input_path);
+                internal::log(LogLevel::Warning, last_error_.to_string());
+                return false;
+            }
+            
+            if (file_changed) {
+                file_changed = false;
+                
+                if (try_get(value)) {
+                    return true;
+                }
+            }
+            
+            auto remaining = timeout - elapsed;
+            file_changed = wait_for_change(seen, std::min(remaining, std::chrono::milliseconds(100)));
+        }
+    }
+    
+    template<typename T>
+    bool get_timeout_polling(T& value, const std::string& input_path,
+                             std::chrono::milliseconds timeout) {
+        auto start_time = std::chrono::steady_clock::now();
+        
+        while (true) {
+            auto elapsed = std::chrono::steady_clock::now() - start_time;
+            if (elapsed >= timeout) {
+                std::lock_guard<std::mutex> lock(mtx_);
+                last_error_ = ErrorInfo(ErrorType::Timeout,
+                                      "Timeout waiting for valid value",
+                                      input_path);
+                internal::log(LogLevel::Warning, last_error_.to_string());
+                return false;
+            }
+            
+            if (try_get(value)) {
+                return true;
+            }
+            
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+};
+
+// ============================================================
+// Dependency Injection Support (Testable Design)
+// ============================================================
+
+/**
+ * @brief RAII context for LiveTuner
+ * 
+ * Avoids global state in tests and large applications.
+ * Automatically cleans up when leaving scope.
+ */
+class ScopedTunerContext {
+public:
+    explicit ScopedTunerContext(std::string_view file_path = "params.txt")
+        : tuner_(std::make_unique<LiveTuner>(file_path)) {}
+    
+    ~ScopedTunerContext() = default;
+    
+    ScopedTunerContext(const ScopedTunerContext&) = delete;
+    ScopedTunerContext& operator=(const ScopedTunerContext&) = delete;
+    ScopedTunerContext(ScopedTunerContext&&) = default;
+    ScopedTunerContext& operator=(ScopedTunerContext&&) = default;
+    
+    LiveTuner& tuner() { return *tuner_; }
+    const LiveTuner& tuner() const { return *tuner_; }
+    
+private:
+    std::unique_ptr<LiveTuner> tuner_;
+};
+
+/**
+ * @brief RAII context for Params
+ */
+class ScopedParamsContext {
+public:
+    explicit ScopedParamsContext(std::string_view file_path = "params.json",
+                                  FileFormat format = FileFormat::Auto)
+        : params_(std::make_unique<Params>(file_path, format)) {}
+    
+    ~ScopedParamsContext() = default;
+    
+    ScopedParamsContext(const ScopedParamsContext&) = delete;
+    ScopedParamsContext& operator=(const ScopedParamsContext&) = delete;
+    ScopedParamsContext(ScopedParamsContext&&) = default;
+    ScopedParamsContext& operator=(ScopedParamsContext&&) = default;
+    
+    Params& params() { return *params_; }
+    const Params& params() const { return *params_; }
+    
+private:
+    std::unique_ptr<Params> params_;
+};
+
+// ============================================================
+// Global Instances (For Personal Development and Small Projects)
+// ============================================================
+
+namespace internal {
+
+/**
+ * @brief Global instance management class
+ * 
+ * Internal implementation class to allow complete reset of global
+ * state during testing. Not normally used directly.
+ */
+class GlobalInstanceManager {
+public:
+    static GlobalInstanceManager& instance() {
+        static GlobalInstanceManager mgr;
+        return mgr;
+    }
+    
+    LiveTuner& get_tuner() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (!tuner_) {
+            tuner_ = std::make_unique<LiveTuner>();
+        }
+        return *tuner_;
+    }
+    
+    Params& get_params() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (!params_) {
+            params_ = std::make_unique<Params>("config.json");
+        }
+        return *params_;
+    }
+    
+    /**
+     * @brief Completely reset global LiveTuner
+     * 
+     * Creates new instance and clears all state.
+     * Use in unit test setUp/tearDown.
+     */
+    void reset_tuner() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        tuner_.reset();
+    }
+    
+    /**
+     * @brief Completely reset global Params
+     * 
+     * Creates new instance and clears all bindings and state.
+     * Use in unit test setUp/tearDown.
+     */
+    void reset_params() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        params_.reset();
+    }
+    
+    /**
+     * @brief Reset all global instances
+     */
+    void reset_all() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        tuner_.reset();
+        params_.reset();
+    }
+
+private:
+    GlobalInstanceManager() = default;
+    
+    std::mutex mtx_;
+    std::unique_ptr<LiveTuner> tuner_;
+    std::unique_ptr<Params> params_;
+};
+
+} // namespace internal
+
+/**
+ * @brief Get default LiveTuner instance
+ */
+inline LiveTuner& get_default_tuner() {
+    return internal::GlobalInstanceManager::instance().get_tuner();
+}
+
+/**
+ * @brief Get default Params instance
+ */
+inline Params& get_default_params() {
+    return internal::GlobalInstanceManager::instance().get_params();
+}
+
+// ============================================================
+// Convenient Global Functions (For Personal Development and Small Projects)
+// ============================================================
+
+/**
+ * @brief Set file to monitor
+ */
+inline void tune_init(std::string_view file_path) {
+    get_default_tuner().set_file(file_path);
+}
+
+/**
+ * @brief Try to read value immediately (non-blocking)
+ */
+template<typename T>
+inline bool tune_try(T& value) {
+    return get_default_tuner().try_get(value);
+}
+
+/**
+ * @brief Block until value is read
+ */
+template<typename T>
+inline void tune(T& value) {
+    get_default_tuner().get(value);
+}
+
+/**
+ * @brief Read value with timeout
+ */
+template<typename T>
+inline bool tune_timeout(T& value, std::chrono::milliseconds timeout) {
+    return get_default_tuner().get_timeout(value, timeout);
+}
+
+/**
+ * @brief Read value asynchronously (future version)
+ */
+template<typename T>
+inline std::future<T> tune_async() {
+    return get_default_tuner().get_async<T>();
+}
+
+/**
+ * @brief Read value asynchronously (callback version)
+ */
+template<typename T, typename Callback>
+inline void tune_async(Callback callback) {
+    get_default_tuner().get_async<T>(std::move(callback));
+}
+
+/**
+ * @brief Set event-driven mode
+ */
+inline void tune_set_event_driven(bool enabled) {
+    get_default_tuner().set_event_driven(enabled);
+}
+
+inline bool tune_is_event_driven() {
+    return get_default_tuner().is_event_driven();
+}
+
+inline bool tune_has_native_file_watch() {
+    return LiveTuner::has_native_file_watch();
+}
+
+/**
+ * @brief Reset state (for testing)
+ */
+inline void tune_reset() {
+    get_default_tuner().reset();
+}
+
+#ifdef LIVETUNER_ENABLE_TEST_SUPPORT
+/**
+ * @brief Completely reset global LiveTuner
+ * 
+ * More powerful reset than tune_reset(), recreates instance itself.
+ * Use when complete separation between tests is needed.
+ * 
+ * @note Requires LIVETUNER_ENABLE_TEST_SUPPORT to be defined.
+ */
+inline void reset_global_tuner() {
+    internal::GlobalInstanceManager::instance().reset_tuner();
+}
+#endif // LIVETUNER_ENABLE_TEST_SUPPORT
+
+// ============================================================
+// Convenient Global Functions for Params
+// ============================================================
+
+/**
+ * @brief Set file for global Params
+ */
+inline void params_init(std::string_view file_path, FileFormat format = FileFormat::Auto) {
+    get_default_params().set_file(file_path, format);
+}
+
+/**
+ * @brief Bind variable to global Params
+ */
+template<typename T>
+inline void params_bind(const std::string& name, T& variable, T default_value = T{}) {
+    get_default_params().bind(name, variable, default_value);
+}
+
+/**
+ * @brief Update global Params (non-blocking)
+ */
+inline bool params_update() {
+    return get_default_params().update();
+}
+
+/**
+ * @brief Start watching global Params
+ */
+inline void params_watch() {
+    get_default_params().start_watching();
+}
+
+/**
+ * @brief Poll global Params for changes
+ */
+inline bool params_poll() {
+    return get_default_params().poll();
+}
+
+/**
+ * @brief Get value from global Params
+ */
+template<typename T>
+inline std::optional<T> params_get(const std::string& name) {
+    return get_default_params().get<T>(name);
+}
+
+/**
+ * @brief Get value from global Params (with default value)
+ */
+template<typename T>
+inline T params_get_or(const std::string& name, T default_value) {
+    return get_default_params().get_or(name, default_value);
+}
+
+/**
+ * @brief Set change callback for global Params
+ */
+inline void params_on_change(std::function<void()> callback) {
+    get_default_params().on_change(std::move(callback));
+}
+
+/**
+ * @brief Reset global Params
+ */
+inline void params_reset() {
+    get_default_params().unbind_all();
+    get_default_params().invalidate_cache();
+}
+
+#ifdef LIVETUNER_ENABLE_TEST_SUPPORT
+/**
+ * @brief Completely reset global Params
+ */
+inline void reset_global_params() {
+    internal::GlobalInstanceManager::instance().reset_params();
+}
+
+/**
+ * @brief Reset all global instances
+ */
+inline void reset_all_globals() {
+    internal::GlobalInstanceManager::instance().reset_all();
+}
+#endif // LIVETUNER_ENABLE_TEST_SUPPORT
+
+// ============================================================
+// nlohmann/json Support (Optional Feature)
+// ============================================================
+
+#ifdef LIVETUNER_USE_NLOHMANN_JSON
+
+#ifndef NLOHMANN_JSON_VERSION_MAJOR
+#error "LIVETUNER_USE_NLOHMANN_JSON is defined but nlohmann/json.hpp is not included. Please #include <nlohmann/json.hpp> before LiveTuner.h"
+#endif
+
+/**
+ * @brief Parameter management for nlohmann/json
+ * 
+ * Supports nested objects, arrays, and type-safe value retrieval.
+ * Requires: #include <nlohmann/json.hpp> before this header.
+ * 
+ * @code
+ * #define LIVETUNER_USE_NLOHMANN_JSON
+ * #include <nlohmann/json.hpp>
+ * #include "LiveTuner.h"
+ * 
+ * using json = nlohmann::json;
+ * 
+ * livetuner::NlohmannParams params("config.json");
+ * 
+ * // Basic usage
+ * float speed = params.get<float>("player.speed", 1.0f);
+ * std::string name = params.get<std::string>("player.name", "Player");
+ * 
+ * // Get array
+ * auto colors = params.get<std::vector<int>>("colors", {255, 0, 0});
+ * 
+ * // Get nested object
+ * auto player_data = params.get_json("player");
+ * 
+ * while (running) {
+ *     if (params.update()) {
+ *         // Process when JSON changes
+ *         speed = params.get<float>("player.speed", 1.0f);
+ *     }
+ * }
+ * @endcode
+ * 
+ * JSON file example:
+ * @code
+ * {
+ *   "player": {
+ *     "name": "Hero",
+ *     "speed": 2.5,
+ *     "position": [10.0, 20.0, 30.0]
+ *   },
+ *   "colors": [255, 128, 0],
+ *   "debug": true
+ * }
+ * @endcode
+ */
+class NlohmannParams {
+public:
+    using json = nlohmann::json;
+    using ErrorCallback = std::function<void(const ErrorInfo&)>;
+
+    /**
+     * @brief Constructor
+     * @param file_path Path to JSON file to watch
+     */
+    explicit NlohmannParams(const std::string& file_path)
+        : file_path_(file_path)
+        , error_callback_(nullptr)
+    {
+        // Initial load
+        load();
+        
+        // Initialize FileWatcher
+        internal::FileWatcherConfig config;
+        watcher_ = std::make_unique<internal::FileWatcher>(config);
+        watcher_->start(file_path, []() {
+            // Callback not needed (changes checked in check())
+        });
+    }
+
+    /**
+     * @brief Destructor
+     */
+    ~NlohmannParams();
+
+    // Copy and move prohibited
+    NlohmannParams(const NlohmannParams&) = delete;
+    NlohmannParams& operator=(const NlohmannParams&) = delete;
+    NlohmannParams(NlohmannParams&&) = delete;
+    NlohmannParams& operator=(NlohmannParams&&) = delete;
+
+    /**
+     * @brief Check file changes and update
+     * @return true if updated
+     */
+    bool update() {
+        // Check for changes non-blocking (timeout 0ms)
+        if (!watcher_->wait_for_change(std::chrono::milliseconds(0))) {
+            return false;
+        }
+        return load();
+    }
+
+    /**
+     * @brief Get value (specify JSON path)
+     * @tparam T Type of value to retrieve
+     * @param json_path JSON path (e.g., "player.speed" or "colors[0]")
+     * @param default_value Default value
+     * @return Retrieved value (default value on error)
+     */
+    template<typename T>
+    T get(const std::string& json_path, const T& default_value = T{}) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        try {
+            json value = get_value_by_path(json_, json_path);
+            if (value.is_null()) {
+                return default_value;
+            }
+            return value.get<T>();
+        } catch (const std::exception& e) {
+            handle_error(ErrorType::ParseError, 
+                        "Failed to get value at '" + json_path + "': " + e.what());
+            return default_value;
+        }
+    }
+
+    /**
+     * @brief Get JSON object
+     * @param json_path JSON path (root if omitted)
+     * @return JSON object
+     */
+    json get_json(const std::string& json_path = "") const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        if (json_path.empty()) {
+            return json_;
+        }
+        
+        try {
+            return get_value_by_path(json_, json_path);
+        } catch (const std::exception& e) {
+            handle_error(ErrorType::ParseError, 
+                        "Failed to get JSON at '" + json_path + "': " + e.what());
+            return json{};
+        }
+    }
+
+    /**
+     * @brief Check if value exists
+     * @param json_path JSON path
+     * @return true if exists
+     */
+    bool has(const std::string& json_path) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        try {
+            json value = get_value_by_path(json_, json_path);
+            return !value.is_null();
+        } catch (...) {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Set error callback
+     * @param callback Callback function called on error
+     */
+    void set_error_callback(ErrorCallback callback) {
+        error_callback_ = std::move(callback);
+    }
+
+    /**
+     * @brief Get last error
+     * @return Error information
+     */
+    const ErrorInfo& last_error() const {
+        return last_error_;
+    }
+
+    /**
+     * @brief Save current JSON to file
+     * @param pretty Whether to format output
+     * @return true if successful
+     */
+    bool save(bool pretty = true) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        try {
+            std::ofstream file(file_path_);
+            if (!file) {
+                handle_error(ErrorType::FileAccessDenied, 
+                           "Failed to open file for writing: " + file_path_);
+                return false;
+            }
+            
+            if (pretty) {
+                file << json_.dump(2);  // 2-space indent
+            } else {
+                file << json_.dump();
+            }
+            
+            return true;
+        } catch (const std::exception& e) {
+            handle_error(ErrorType::FileReadError, 
+                        "Failed to save JSON: " + std::string(e.what()));
+            return false;
+        }
+    }
+
+    /**
+     * @brief Set JSON (change value from program)
+     * @param json_path JSON path
+     * @param value Value to set
+     * @return true if successful
+     */
+    template<typename T>
+    bool set(const std::string& json_path, const T& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        try {
+            set_value_by_path(json_, json_path, value);
+            return true;
+        } catch (const std::exception& e) {
+            handle_error(ErrorType::ParseError, 
+                        "Failed to set value at '" + json_path + "': " + e.what());
+            return false;
+        }
+    }
+
+    /**
+     * @brief Get file path
+     */
+    const std::string& file_path() const {
+        return file_path_;
+    }
+
+    /**
+     * @brief For debugging: Get entire current JSON as string
+     */
+    std::string dump(int indent = 2) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return json_.dump(indent);
+    }
+
+private:
+    /**
+     * @brief Load JSON file
+     */
+    bool load() {
+        try {
+            std::ifstream file(file_path_);
+            if (!file) {
+                handle_error(ErrorType::FileNotFound, 
+                           "File not found: " + file_path_);
+                return false;
+            }
+            
+            std::lock_guard<std::mutex> lock(mutex_);
+            
+            // Empty file check
+            file.seekg(0, std::ios::end);
+            if (file.tellg() == 0) {
+                json_ = json::object();  // Initialize as empty object
+                return true;
+            }
+            file.seekg(0, std::ios::beg);
+            
+            // JSON parse
+            try {
+                file >> json_;
+            } catch (const json::parse_error& e) {
+                handle_error(ErrorType::ParseError, 
+                           "JSON parse error: " + std::string(e.what()));
+                return false;
+            }
+            
+            return true;
+            
+        } catch (const std::exception& e) {
+            handle_error(ErrorType::FileReadError, 
+                        "Failed to read file: " + std::string(e.what()));
+            return false;
+        }
+    }
+
+    /**
+     * @brief Get value by JSON path
+     * @param j JSON object
+     * @param path Path (dot-separated, e.g., "player.speed")
+     * @return Value (null if not found)
+     */
+    static json get_value_by_path(const json& j, const std::string& path) {
+        if (path.empty()) {
+            return j;
+        }
+        
+        json current = j;
+        std::string token;
+        std::istringstream path_stream(path);
+        
+        while (std::getline(path_stream, token, '.')) {
+            // Array access support: "array[0]"
+            size_t bracket_pos = token.find('[');
+            if (bracket_pos != std::string::npos) {
+                std::string key = token.substr(0, bracket_pos);
+                size_t bracket_end = token.find(']', bracket_pos);
+                if (bracket_end == std::string::npos) {
+                    throw std::runtime_error("Invalid array syntax in path: " + path);
+                }
+                
+                std::string index_str = token.substr(bracket_pos + 1, bracket_end - bracket_pos - 1);
+                int index = std::stoi(index_str);
+                
+                if (!key.empty()) {
+                    if (!current.contains(key) || !current[key].is_array()) {
+                        return json{};
+                    }
+                    current = current[key];
+                }
+                
+                if (index < 0 || static_cast<size_t>(index) >= current.size()) {
+                    return json{};
+                }
+                current = current[index];
+            } else {
+                if (!current.is_object() || !current.contains(token)) {
+                    return json{};
+                }
+                current = current[token];
+            }
+        }
+        
+        return current;
+    }
+
+    /**
+     * @brief Set value by JSON path
+     * @param j JSON object
+     * @param path Path (dot-separated)
+     * @param value Value to set
+     */
+    template<typename T>
+    static void set_value_by_path(json& j, const std::string& path, const T& value) {
+        if (path.empty()) {
+            j = value;
+            return;
+        }
+        
+        json* current = &j;
+        std::string token;
+        std::istringstream path_stream(path);
+        std::vector<std::string> tokens;
+        
+        while (std::getline(path_stream, token, '.')) {
+            tokens.push_back(token);
+        }
+        
+        for (size_t i = 0; i < tokens.size() - 1; ++i) {
+            const auto& tok = tokens[i];
+            
+            if (!current->is_object()) {
+                *current = json::object();
+            }
+            
+            if (!current->contains(tok)) {
+                (*current)[tok] = json::object();
+            }
+            
+            current = &(*current)[tok];
+        }
+        
+        if (!current->is_object()) {
+            *current = json::object();
+        }
+        
+        (*current)[tokens.back()] = value;
+    }
+
+    /**
+     * @brief Handle error
+     */
+    void handle_error(ErrorType type, const std::string& message) const {
+        last_error_ = ErrorInfo(type, message, file_path_);
+        
+        if (error_callback_) {
+            error_callback_(last_error_);
+        }
+    }
+
+private:
+    std::string file_path_;
+    std::unique_ptr<internal::FileWatcher> watcher_;
+    mutable json json_;
+    mutable std::mutex mutex_;
+    mutable ErrorInfo last_error_;
+    ErrorCallback error_callback_;
+};
+
+/**
+ * @brief Automatic binding helper using nlohmann/json
+ */
+class NlohmannBinder {
+public:
+    using json = nlohmann::json;
+
+    explicit NlohmannBinder(const std::string& file_path)
+        : params_(file_path)
+    {}
+
+    /**
+     * @brief Bind variable
+     * @tparam T Variable type
+     * @param json_path JSON path
+     * @param variable Reference to variable to bind
+     * @param default_value Default value
+     */
+    template<typename T>
+    void bind(const std::string& json_path, T& variable, const T& default_value = T{}) {
+        // Set initial value
+        variable = params_.get<T>(json_path, default_value);
+        
+        // Save binding information
+        bindings_.emplace_back([this, json_path, &variable, default_value]() {
+            variable = params_.get<T>(json_path, default_value);
+        });
+    }
+
+    /**
+     * @brief Check for updates and update all bound variables
+     * @return true if updated
+     */
+    bool update() {
+        if (!params_.update()) {
+            return false;
+        }
+        
+        // Update all bound variables
+        for (auto& binding : bindings_) {
+            binding();
+        }
+        
+        return true;
+    }
+
+    /**
+     * @brief Get the underlying NlohmannParams
+     */
+    NlohmannParams& params() {
+        return params_;
+    }
+
+    const NlohmannParams& params() const {
+        return params_;
+    }
+
+private:
+    NlohmannParams params_;
+    std::vector<std::function<void()>> bindings_;
+};
+
+#endif // LIVETUNER_USE_NLOHMANN_JSON
+
+} // namespace livetuner
+
+// ============================================================
+// Test Support
+// ============================================================
+
+/**
+ * LIVETUNER_ENABLE_TEST_SUPPORT provides testing utilities:
+ * TestFixture, ITuner/IParams interfaces, adapters, factories.
+ * 
+ * Usage: #define LIVETUNER_ENABLE_TEST_SUPPORT before including.
+ */
+#ifdef LIVETUNER_ENABLE_TEST_SUPPORT
+#include "LiveTunerTest.h"
+#endif
+
+/*
+ * ============================================================================
+ * LICENSE INFORMATION
+ * ============================================================================
+ * 
+ * This library includes picojson (2-clause BSD License).
+ * Copyright 2009-2010 Cybozu Labs, Inc., 2011-2014 Kazuho Oku.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ * ----------------------------------------------------------------------------
+ */ 
+
+// ============================================================================
+// IMPLEMENTATION SECTION
+// ============================================================================
+// Define LIVETUNER_IMPLEMENTATION in ONE source file before including.
+// Without it, FileWatcher uses polling mode only.
+// ============================================================================
+
+#ifdef LIVETUNER_IMPLEMENTATION
+
+// ============================================================
+// MSVC warning suppression
+// ============================================================
+// Suppress warnings from platform headers (Windows.h, etc.)
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+// ============================================================
+// Platform-specific headers (only in implementation)
+// ============================================================
+
+#ifdef _WIN32
+// Settings to prevent Windows.h macro pollution
+#ifndef LIVETUNER_NO_WIN32_LEAN
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define LIVETUNER_IMPL_DEFINED_WIN32_LEAN_AND_MEAN
+#endif
+#ifndef VC_EXTRALEAN
+#define VC_EXTRALEAN
+#define LIVETUNER_IMPL_DEFINED_VC_EXTRALEAN
+#endif
+#endif
+
+#ifndef LIVETUNER_NO_NOMINMAX
+#ifndef NOMINMAX
+#define NOMINMAX
+#define LIVETUNER_IMPL_DEFINED_NOMINMAX
+#endif
+#endif
+
+#include <windows.h>
+
+// Restore defined macros
+#ifdef LIVETUNER_IMPL_DEFINED_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef LIVETUNER_IMPL_DEFINED_WIN32_LEAN_AND_MEAN
+#endif
+#ifdef LIVETUNER_IMPL_DEFINED_VC_EXTRALEAN
+#undef VC_EXTRALEAN
+#undef LIVETUNER_IMPL_DEFINED_VC_EXTRALEAN
+#endif
+#ifdef LIVETUNER_IMPL_DEFINED_NOMINMAX
+#undef NOMINMAX
+#undef LIVETUNER_IMPL_DEFINED_NOMINMAX
+#endif
+
+#elif defined(__linux__)
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <limits.h>
+#include <cerrno>
+#elif defined(__APPLE__)
+#include <CoreServices/CoreServices.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace livetuner {
+namespace internal {
+
+// ============================================================
+// RAII Resource Wrappers Implementation
+// ============================================================
+
+#ifdef _WIN32
+struct HandleDeleter {
+    void operator()(HANDLE h) const noexcept {
+        if (h != nullptr && h != INVALID_HANDLE_VALUE) {
+            CloseHandle(h);
+        }
+    }
+};
+
+struct InvalidHandleDeleter {
+    void operator()(HANDLE h) const noexcept {
+        if (h != INVALID_HANDLE_VALUE) {
+            CloseHandle(h);
+        }
+    }
+};
+
+using UniqueHandle = std::unique_ptr<std::remove_pointer_t<HANDLE>, HandleDeleter>;
+using UniqueInvalidHandle = std::unique_ptr<std::remove_pointer_t<HANDLE>, InvalidHandleDeleter>;
+
+inline UniqueHandle make_unique_handle(HANDLE h) {
+    return UniqueHandle(h);
+}
+
+inline UniqueInvalidHandle make_unique_invalid_handle(HANDLE h) {
+    return UniqueInvalidHandle(h);
+}
+#endif // _WIN32
+
+#if defined(__linux__) || defined(__APPLE__)
+class UniqueFd {
+public:
+    UniqueFd() : fd_(-1) {}
+    explicit UniqueFd(int fd) : fd_(fd) {}
+    ~UniqueFd() { reset(); }
+    
+    UniqueFd(const UniqueFd&) = delete;
+    UniqueFd& operator=(const UniqueFd&) = delete;
     
-    ~ScopedParamsContext() = default;
+    UniqueFd(UniqueFd&& other) noexcept : fd_(other.fd_) {
+        other.fd_ = -1;
+    }
     
-    ScopedParamsContext(const ScopedParamsContext&) = delete;
-    ScopedParamsContext& operator=(const ScopedParamsContext&) = delete;
-    ScopedParamsContext(ScopedParamsContext&&) = default;
-    ScopedParamsContext& operator=(ScopedParamsContext&&) = default;
+    UniqueFd& operator=(UniqueFd&& other) noexcept {
+        if (this != &other) {
+            reset();
+            fd_ = other.fd_;
+            other.fd_ = -1;
+        }
+        return *this;
+    }
     
-    Params& params() { return *params_; }
-    const Params& params() const { return *params_; }
+    int get() const noexcept { return fd_; }
+    int release() noexcept {
+        int fd = fd_;
+        fd_ = -1;
+        return fd;
+    }
+    
+    void reset(int fd = -1) noexcept {
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+        fd_ = fd;
+    }
+    
+    explicit operator bool() const noexcept { return fd_ >= 0; }
     
 private:
-    std::unique_ptr<Params> params_;
+    int fd_;
 };
+#endif // __linux__ || __APPLE__
 
 // ============================================================
-// Global Instances (For Personal Development and Small Projects)
+// FileReader Implementation
 // ============================================================
 
-namespace internal {
-
-/**
- * @brief Global instance management class
- * 
- * Internal implementation class to allow complete reset of global
- * state during testing. Not normally used directly.
- */
-class GlobalInstanceManager {
-public:
-    static GlobalInstanceManager& instance() {
-        static GlobalInstanceManager mgr;
-        return mgr;
+#if defined(__linux__) || defined(__APPLE__)
+inline bool FileReader::read(const std::filesystem::path& path, ErrorInfo& error) {
+    UniqueFd fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+    if (!fd) {
+        int err = errno;
+        if (err == ENOENT || err == ENOTDIR) {
+            error = ErrorInfo(ErrorType::FileNotFound, "File does not exist", path.string());
+        } else if (err == EACCES || err == EPERM) {
+            error = ErrorInfo(ErrorType::FileAccessDenied,
+                              std::string("Cannot open file for reading: ") + std::strerror(err), path.string());
+        } else {
+            error = ErrorInfo(ErrorType::FileReadError,
+                              std::string("Cannot open file: ") + std::strerror(err), path.string());
+        }
+        return false;
     }
     
-    LiveTuner& get_tuner() {
-        std::lock_guard<std::mutex> lock(mtx_);
-        if (!tuner_) {
-            tuner_ = std::make_unique<LiveTuner>();
+    struct stat st{};
+    if (::fstat(fd.get(), &st) != 0) {
+        error = ErrorInfo(ErrorType::FileReadError,
+                          std::string("Cannot get file size: ") + std::strerror(errno), path.string());
+        return false;
+    }
+    
+    const size_t file_size = static_cast<size_t>(st.st_size);
+    if (file_size == 0) {
+        error = ErrorInfo(ErrorType::FileEmpty, "File is empty", path.string());
+        return false;
+    }
+    
+    // Grow only; the buffer is reused by later reads
+    if (buffer_.size() < file_size) {
+        buffer_.resize(file_size);
+    }
+    
+    size_t total = 0;
+    while (total < file_size) {
+        ssize_t n = ::pread(fd.get(), &buffer_[total], file_size - total, static_cast<off_t>(total));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            error = ErrorInfo(ErrorType::FileReadError,
+                              std::string("Read failed: ") + std::strerror(errno), path.string());
+            return false;
         }
-        return *tuner_;
+        if (n == 0) {
+            break;  // Truncated while reading (editor mid-save)
+        }
+        total += static_cast<size_t>(n);
     }
     
-    Params& get_params() {
-        std::lock_guard<std::mutex> lock(mtx_);
-        if (!params_) {
-            params_ = std::make_unique<Params>("config.json");
+    if (total == 0) {
+        error = ErrorInfo(ErrorType::FileEmpty, "File content is empty after read", path.string());
+        return false;
+    }
+    
+    size_ = total;
+    return true;
+}
+
+#elif defined(_WIN32)
+inline bool FileReader::read(const std::filesystem::path& path, ErrorInfo& error) {
+    auto handle = make_unique_invalid_handle(CreateFileW(
+        path.wstring().c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+    ));
+    if (handle.get() == INVALID_HANDLE_VALUE) {
+        DWORD err = GetLastError();
+        if (err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND) {
+            error = ErrorInfo(ErrorType::FileNotFound, "File does not exist", path.string());
+        } else if (err == ERROR_ACCESS_DENIED || err == ERROR_SHARING_VIOLATION) {
+            error = ErrorInfo(ErrorType::FileAccessDenied, "Cannot open file for reading", path.string());
+        } else {
+            error = ErrorInfo(ErrorType::FileReadError,
+                              "Cannot open file (error " + std::to_string(err) + ")", path.string());
         }
-        return *params_;
+        return false;
     }
     
-    /**
-     * @brief Completely reset global LiveTuner
-     * 
-     * Creates new instance and clears all state.
-     * Use in unit test setUp/tearDown.
-     */
-    void reset_tuner() {
-        std::lock_guard<std::mutex> lock(mtx_);
-        tuner_.reset();
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(handle.get(), &size)) {
+        error = ErrorInfo(ErrorType::FileReadError, "Cannot get file size", path.string());
+        return false;
     }
     
-    /**
-     * @brief Completely reset global Params
-     * 
-     * Creates new instance and clears all bindings and state.
-     * Use in unit test setUp/tearDown.
-     */
-    void reset_params() {
-        std::lock_guard<std::mutex> lock(mtx_);
-        params_.reset();
+    const size_t file_size = static_cast<size_t>(size.QuadPart);
+    if (file_size == 0) {
+        error = ErrorInfo(ErrorType::FileEmpty, "File is empty", path.string());
+        return false;
     }
     
-    /**
-     * @brief Reset all global instances
-     */
-    void reset_all() {
-        std::lock_guard<std::mutex> lock(mtx_);
-        tuner_.reset();
-        params_.reset();
+    // Grow only; the buffer is reused by later reads
+    if (buffer_.size() < file_size) {
+        buffer_.resize(file_size);
     }
-
-private:
-    GlobalInstanceManager() = default;
     
-    std::mutex mtx_;
-    std::unique_ptr<LiveTuner> tuner_;
-    std::unique_ptr<Params> params_;
-};
-
-} // namespace internal
-
-/**
- * @brief Get default LiveTuner instance
- */
-inline LiveTuner& get_default_tuner() {
-    return internal::GlobalInstanceManager::instance().get_tuner();
+    size_t total = 0;
+    while (total < file_size) {
+        DWORD chunk = static_cast<DWORD>(std::min<size_t>(file_size - total, 1u << 30));
+        DWORD bytes_read = 0;
+        if (!ReadFile(handle.get(), &buffer_[total], chunk, &bytes_read, nullptr)) {
+            error = ErrorInfo(ErrorType::FileReadError, "Read failed", path.string());
+            return false;
+        }
+        if (bytes_read == 0) {
+            break;  // Truncated while reading (editor mid-save)
+        }
+        total += bytes_read;
+    }
+    
+    if (total == 0) {
+        error = ErrorInfo(ErrorType::FileEmpty, "File content is empty after read", path.string());
+        return false;
+    }
+    
+    size_ = total;
+    return true;
 }
 
-/**
- * @brief Get default Params instance
- */
-inline Params& get_default_params() {
-    return internal::GlobalInstanceManager::instance().get_params();
+#else
+// Fallback: standard streams
+inline bool FileReader::read(const std::filesystem::path& path, ErrorInfo& error) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::error_code ec;
+        bool exists = std::filesystem::exists(path, ec);
+        error = exists ? ErrorInfo(ErrorType::FileAccessDenied, "Cannot open file for reading", path.string())
+                       : ErrorInfo(ErrorType::FileNotFound, "File does not exist", path.string());
+        return false;
+    }
+    
+    auto end = file.tellg();
+    if (end <= 0) {
+        error = ErrorInfo(ErrorType::FileEmpty, "File is empty", path.string());
+        return false;
+    }
+    
+    const size_t file_size = static_cast<size_t>(end);
+    if (buffer_.size() < file_size) {
+        buffer_.resize(file_size);
+    }
+    file.seekg(0, std::ios::beg);
+    file.read(&buffer_[0], static_cast<std::streamsize>(file_size));
+    
+    size_t total = static_cast<size_t>(file.gcount());
+    if (total == 0) {
+        error = ErrorInfo(ErrorType::FileEmpty, "File content is empty after read", path.string());
+        return false;
+    }
+    
+    size_ = total;
+    return true;
 }
+#endif
 
 // ============================================================
-// Convenient Global Functions (For Personal Development and Small Projects)
+// FileChangeDetector Implementation
 // ============================================================
 
-/**
- * @brief Set file to monitor
- */
-inline void tune_init(std::string_view file_path) {
-    get_default_tuner().set_file(file_path);
-}
-
-/**
- * @brief Try to read value immediately (non-blocking)
- */
-template<typename T>
-inline bool tune_try(T& value) {
-    return get_default_tuner().try_get(value);
-}
-
-/**
- * @brief Block until value is read
- */
-template<typename T>
-inline void tune(T& value) {
-    get_default_tuner().get(value);
-}
-
-/**
- * @brief Read value with timeout
- */
-template<typename T>
-inline bool tune_timeout(T& value, std::chrono::milliseconds timeout) {
-    return get_default_tuner().get_timeout(value, timeout);
-}
-
-/**
- * @brief Read value asynchronously (future version)
- */
-template<typename T>
-inline std::future<T> tune_async() {
-    return get_default_tuner().get_async<T>();
-}
-
-/**
- * @brief Read value asynchronously (callback version)
- */
-template<typename T, typename Callback>
-inline void tune_async(Callback callback) {
-    get_default_tuner().get_async<T>(std::move(callback));
-}
-
-/**
- * @brief Set event-driven mode
- */
-inline void tune_set_event_driven(bool enabled) {
-    get_default_tuner().set_event_driven(enabled);
-}
-
-inline bool tune_is_event_driven() {
-    return get_default_tuner().is_event_driven();
+#if defined(__linux__) || defined(__APPLE__)
+inline bool FileChangeDetector::open_held() {
+    int fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    handle_ = fd;
+    return fd >= 0;
 }
 
-inline bool tune_has_native_file_watch() {
-    return LiveTuner::has_native_file_watch();
+inline bool FileChangeDetector::stat_held(Stamp& stamp) const {
+    struct stat st{};
+    if (::fstat(static_cast<int>(handle_), &st) != 0) {
+        return false;
+    }
+#ifdef __APPLE__
+    const auto& mtime = st.st_mtimespec;
+    const auto& ctime = st.st_ctimespec;
+#else
+    const auto& mtime = st.st_mtim;
+    const auto& ctime = st.st_ctim;
+#endif
+    stamp.dev = static_cast<uint64_t>(st.st_dev);
+    stamp.ino = static_cast<uint64_t>(st.st_ino);
+    stamp.size = static_cast<uint64_t>(st.st_size);
+    stamp.nlink = static_cast<uint64_t>(st.st_nlink);
+    stamp.mtime_ns = static_cast<int64_t>(mtime.tv_sec) * 1000000000 + mtime.tv_nsec;
+    stamp.ctime_ns = static_cast<int64_t>(ctime.tv_sec) * 1000000000 + ctime.tv_nsec;
+    return true;
 }
 
-/**
- * @brief Reset state (for testing)
- */
-inline void tune_reset() {
-    get_default_tuner().reset();
+inline bool FileChangeDetector::path_names_held(const Stamp& stamp) const {
+    struct stat st{};
+    return ::stat(path_.c_str(), &st) == 0 &&
+           static_cast<uint64_t>(st.st_dev) == stamp.dev &&
+           static_cast<uint64_t>(st.st_ino) == stamp.ino;
 }
 
-#ifdef LIVETUNER_ENABLE_TEST_SUPPORT
-/**
- * @brief Completely reset global LiveTuner
- * 
- * More powerful reset than tune_reset(), recreates instance itself.
- * Use when complete separation between tests is needed.
- * 
- * @note Requires LIVETUNER_ENABLE_TEST_SUPPORT to be defined.
- */
-inline void reset_global_tuner() {
-    internal::GlobalInstanceManager::instance().reset_tuner();
+inline void FileChangeDetector::close() {
+    if (handle_ >= 0) {
+        ::close(static_cast<int>(handle_));
+    }
+    handle_ = -1;
 }
-#endif // LIVETUNER_ENABLE_TEST_SUPPORT
-
-// ============================================================
-// Convenient Global Functions for Params
-// ============================================================
 
-/**
- * @brief Set file for global Params
- */
-inline void params_init(std::string_view file_path, FileFormat format = FileFormat::Auto) {
-    get_default_params().set_file(file_path, format);
+#elif defined(_WIN32)
+// FILETIME counts 100 ns intervals since 1601-01-01
+inline int64_t filetime_to_unix_ns(int64_t ticks) {
+    return (ticks - 116444736000000000LL) * 100;
 }
 
-/**
- * @brief Bind variable to global Params
- */
-template<typename T>
-inline void params_bind(const std::string& name, T& variable, T default_value = T{}) {
-    get_default_params().bind(name, variable, default_value);
+inline bool file_identity(HANDLE handle, uint64_t& dev, uint64_t& ino, uint64_t* nlink) {
+    BY_HANDLE_FILE_INFORMATION info{};
+    if (!GetFileInformationByHandle(handle, &info)) {
+        return false;
+    }
+    dev = info.dwVolumeSerialNumber;
+    ino = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+    if (nlink) {
+        *nlink = info.nNumberOfLinks;
+    }
+    return true;
 }
 
-/**
- * @brief Update global Params (non-blocking)
- */
-inline bool params_update() {
-    return get_default_params().update();
+inline bool FileChangeDetector::open_held() {
+    // Share everything: editors must still be able to replace or delete the file
+    HANDLE handle = CreateFileW(path_.c_str(), FILE_READ_ATTRIBUTES,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    handle_ = reinterpret_cast<intptr_t>(handle);
+    return handle != INVALID_HANDLE_VALUE;
 }
 
-/**
- * @brief Start watching global Params
- */
-inline void params_watch() {
-    get_default_params().start_watching();
+inline bool FileChangeDetector::stat_held(Stamp& stamp) const {
+    HANDLE handle = reinterpret_cast<HANDLE>(handle_);
+    FILE_BASIC_INFO basic{};
+    FILE_STANDARD_INFO standard{};
+    if (!file_identity(handle, stamp.dev, stamp.ino, nullptr) ||
+        !GetFileInformationByHandleEx(handle, FileBasicInfo, &basic, sizeof(basic)) ||
+        !GetFileInformationByHandleEx(handle, FileStandardInfo, &standard, sizeof(standard))) {
+        return false;
+    }
+    stamp.size = static_cast<uint64_t>(standard.EndOfFile.QuadPart);
+    stamp.nlink = standard.DeletePending ? 0 : standard.NumberOfLinks;
+    stamp.mtime_ns = filetime_to_unix_ns(basic.LastWriteTime.QuadPart);
+    stamp.ctime_ns = filetime_to_unix_ns(basic.ChangeTime.QuadPart);
+    return true;
 }
 
-/**
- * @brief Poll global Params for changes
- */
-inline bool params_poll() {
-    return get_default_params().poll();
+inline bool FileChangeDetector::path_names_held(const Stamp& stamp) const {
+    UniqueInvalidHandle handle(CreateFileW(path_.c_str(), FILE_READ_ATTRIBUTES,
+                                           FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                           nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+    uint64_t dev = 0;
+    uint64_t ino = 0;
+    return handle.get() != INVALID_HANDLE_VALUE && file_identity(handle.get(), dev, ino, nullptr) &&
+           dev == stamp.dev && ino == stamp.ino;
 }
 
-/**
- * @brief Get value from global Params
- */
-template<typename T>
-inline std::optional<T> params_get(const std::string& name) {
-    return get_default_params().get<T>(name);
+inline void FileChangeDetector::close() {
+    if (handle_ != -1) {
+        CloseHandle(reinterpret_cast<HANDLE>(handle_));
+    }
+    handle_ = -1;
 }
 
-/**
- * @brief Get value from global Params (with default value)
- */
-template<typename T>
-inline T params_get_or(const std::string& name, T default_value) {
-    return get_default_params().get_or(name, default_value);
+#else
+// No descriptor API: stat the path each time (size + mtime)
+inline bool FileChangeDetector::open_held() {
+    std::error_code ec;
+    handle_ = std::filesystem::is_regular_file(path_, ec) ? 0 : -1;
+    return handle_ == 0;
 }
 
-/**
- * @brief Set change callback for global Params
- */
-inline void params_on_change(std::function<void()> callback) {
-    get_default_params().on_change(std::move(callback));
+inline bool FileChangeDetector::stat_held(Stamp& stamp) const {
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path_, ec);
+    auto mtime = std::filesystem::last_write_time(path_, ec);
+    if (ec) {
+        return false;
+    }
+    stamp.size = static_cast<uint64_t>(size);
+    stamp.nlink = 1;
+    stamp.mtime_ns = static_cast<int64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count());
+    return true;
 }
 
-/**
- * @brief Reset global Params
- */
-inline void params_reset() {
-    get_default_params().unbind_all();
-    get_default_params().invalidate_cache();
+inline bool FileChangeDetector::path_names_held(const Stamp&) const {
+    return true;
 }
 
-#ifdef LIVETUNER_ENABLE_TEST_SUPPORT
-/**
- * @brief Completely reset global Params
- */
-inline void reset_global_params() {
-    internal::GlobalInstanceManager::instance().reset_params();
+inline void FileChangeDetector::close() {
+    handle_ = -1;
 }
+#endif
 
-/**
- * @brief Reset all global instances
- */
-inline void reset_all_globals() {
-    internal::GlobalInstanceManager::instance().reset_all();
+inline FileChangeDetector::Result FileChangeDetector::check(const std::filesystem::path& path) {
+    if (path != path_) {
+        reset();
+        path_ = path;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    
+    Stamp stamp;
+    bool held = handle_ != -1 && stat_held(stamp);
+    if (held && stamp.nlink != 0 && now - last_path_check_ >= path_check_interval) {
+        last_path_check_ = now;
+        held = path_names_held(stamp);
+    }
+    if (!held || stamp.nlink == 0) {
+        // Removed or replaced: follow the path to the current file
+        close();
+        if (!open_held() || !stat_held(stamp)) {
+            close();
+            has_last_ = false;
+            return Result::Missing;
+        }
+        last_path_check_ = now;
+    }
+    
+    bool changed = !has_last_ || !stamp.same_file_state(last_);
+    if (!changed && racy_ && now - last_report_ >= racy_recheck_interval) {
+        changed = true;  // A write in the same timestamp tick would be invisible
+    }
+    last_ = stamp;
+    has_last_ = true;
+    if (!changed) {
+        return Result::Unchanged;
+    }
+    
+    last_report_ = now;
+    const auto wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const auto racy_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(racy_window).count();
+    racy_ = std::max(stamp.mtime_ns, stamp.ctime_ns) + racy_ns > wall_ns;
+    return Result::Changed;
 }
-#endif // LIVETUNER_ENABLE_TEST_SUPPORT
 
 // ============================================================
-// nlohmann/json Support (Optional Feature)
+// Timer Wheel (watcher-thread deadlines)
 // ============================================================
 
-#ifdef LIVETUNER_USE_NLOHMANN_JSON
-
-#ifndef NLOHMANN_JSON_VERSION_MAJOR
-#error "LIVETUNER_USE_NLOHMANN_JSON is defined but nlohmann/json.hpp is not included. Please #include <nlohmann/json.hpp> before LiveTuner.h"
-#endif
-
 /**
- * @brief Parameter management for nlohmann/json
- * 
- * Supports nested objects, arrays, and type-safe value retrieval.
- * Requires: #include <nlohmann/json.hpp> before this header.
- * 
- * @code
- * #define LIVETUNER_USE_NLOHMANN_JSON
- * #include <nlohmann/json.hpp>
- * #include "LiveTuner.h"
- * 
- * using json = nlohmann::json;
- * 
- * livetuner::NlohmannParams params("config.json");
- * 
- * // Basic usage
- * float speed = params.get<float>("player.speed", 1.0f);
- * std::string name = params.get<std::string>("player.name", "Player");
- * 
- * // Get array
- * auto colors = params.get<std::vector<int>>("colors", {255, 0, 0});
- * 
- * // Get nested object
- * auto player_data = params.get_json("player");
- * 
- * while (running) {
- *     if (params.update()) {
- *         // Process when JSON changes
- *         speed = params.get<float>("player.speed", 1.0f);
- *     }
- * }
- * @endcode
+ * @brief Hashed timer wheel keyed by id
  * 
- * JSON file example:
- * @code
- * {
- *   "player": {
- *     "name": "Hero",
- *     "speed": 2.5,
- *     "position": [10.0, 20.0, 30.0]
- *   },
- *   "colors": [255, 128, 0],
- *   "debug": true
- * }
- * @endcode
+ * Scheduling an id again moves its deadline; superseded and cancelled
+ * entries are dropped lazily when their slot comes up. Not thread-safe:
+ * owned by the thread that services it.
  */
-class NlohmannParams {
+class TimerWheel {
 public:
-    using json = nlohmann::json;
-    using ErrorCallback = std::function<void(const ErrorInfo&)>;
-
+    using Clock = std::chrono::steady_clock;
+    
+    explicit TimerWheel(std::chrono::milliseconds tick = std::chrono::milliseconds(1),
+                        size_t slot_count = 256)
+        : origin_(Clock::now())
+        , tick_(tick.count() > 0 ? tick : std::chrono::milliseconds(1))
+        , slots_(slot_count > 0 ? slot_count : 1) {}
+    
+    bool empty() const { return deadlines_.empty(); }
+    
     /**
-     * @brief Constructor
-     * @param file_path Path to JSON file to watch
+     * @brief Schedule (or move) the timer for an id
      */
-    explicit NlohmannParams(const std::string& file_path)
-        : file_path_(file_path)
-        , error_callback_(nullptr)
-    {
-        // Initial load
-        load();
-        
-        // Initialize FileWatcher
-        internal::FileWatcherConfig config;
-        watcher_ = std::make_unique<internal::FileWatcher>(config);
-        watcher_->start(file_path, []() {
-            // Callback not needed (changes checked in check())
-        });
+    void schedule(uint64_t id, Clock::time_point deadline) {
+        uint64_t tick = std::max(tick_ceil(deadline), current_);
+        deadlines_[id] = tick;
+        slots_[tick % slots_.size()].push_back(Entry{id, tick});
     }
-
-    /**
-     * @brief Destructor
-     */
-    ~NlohmannParams();
-
-    // Copy and move prohibited
-    NlohmannParams(const NlohmannParams&) = delete;
-    NlohmannParams& operator=(const NlohmannParams&) = delete;
-    NlohmannParams(NlohmannParams&&) = delete;
-    NlohmannParams& operator=(NlohmannParams&&) = delete;
-
-    /**
-     * @brief Check file changes and update
-     * @return true if updated
-     */
-    bool update() {
-        // Check for changes non-blocking (timeout 0ms)
-        if (!watcher_->wait_for_change(std::chrono::milliseconds(0))) {
-            return false;
-        }
-        return load();
+    
+    void cancel(uint64_t id) {
+        deadlines_.erase(id);
     }
-
+    
     /**
-     * @brief Get value (specify JSON path)
-     * @tparam T Type of value to retrieve
-     * @param json_path JSON path (e.g., "player.speed" or "colors[0]")
-     * @param default_value Default value
-     * @return Retrieved value (default value on error)
+     * @brief Milliseconds until the earliest deadline (-1 if none, 0 if due)
      */
-    template<typename T>
-    T get(const std::string& json_path, const T& default_value = T{}) const {
-        std::lock_guard<std::mutex> lock(mutex_);
+    int next_timeout(Clock::time_point now) const {
+        if (deadlines_.empty()) {
+            return -1;
+        }
         
-        try {
-            json value = get_value_by_path(json_, json_path);
-            if (value.is_null()) {
-                return default_value;
+        // Look one revolution ahead; later rounds need a full scan
+        std::optional<uint64_t> earliest;
+        for (size_t k = 0; k < slots_.size() && !earliest; ++k) {
+            uint64_t tick = current_ + k;
+            for (const auto& entry : slots_[tick % slots_.size()]) {
+                if (entry.tick == tick && is_live(entry)) {
+                    earliest = tick;
+                    break;
+                }
             }
-            return value.get<T>();
-        } catch (const std::exception& e) {
-            handle_error(ErrorType::ParseError, 
-                        "Failed to get value at '" + json_path + "': " + e.what());
-            return default_value;
         }
+        if (!earliest) {
+            for (const auto& [id, tick] : deadlines_) {
+                if (!earliest || tick < *earliest) {
+                    earliest = tick;
+                }
+            }
+        }
+        
+        auto remaining = tick_time(*earliest) - now;
+        if (remaining <= Clock::duration::zero()) {
+            return 0;
+        }
+        return static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(remaining).count());
     }
-
+    
     /**
-     * @brief Get JSON object
-     * @param json_path JSON path (root if omitted)
-     * @return JSON object
+     * @brief Run fn(id) for every timer due at `now` (fn may reschedule)
      */
-    json get_json(const std::string& json_path = "") const {
-        std::lock_guard<std::mutex> lock(mutex_);
+    template<typename Fn>
+    void expire(Clock::time_point now, Fn&& fn) {
+        const uint64_t now_tick = tick_floor(now);
+        if (now_tick < current_) {
+            return;
+        }
         
-        if (json_path.empty()) {
-            return json_;
+        std::vector<uint64_t> due;
+        if (deadlines_.empty()) {
+            for (auto& slot : slots_) slot.clear();
+        } else if (now_tick - current_ >= slots_.size()) {
+            // Long gap: one sweep over every slot instead of tick by tick
+            for (auto& slot : slots_) {
+                collect_due(slot, now_tick, due);
+            }
+        } else {
+            for (uint64_t tick = current_; tick <= now_tick; ++tick) {
+                collect_due(slots_[tick % slots_.size()], now_tick, due);
+            }
         }
+        current_ = now_tick + 1;
         
-        try {
-            return get_value_by_path(json_, json_path);
-        } catch (const std::exception& e) {
-            handle_error(ErrorType::ParseError, 
-                        "Failed to get JSON at '" + json_path + "': " + e.what());
-            return json{};
+        for (uint64_t id : due) {
+            fn(id);
+        }
+    }
+
+private:
+    struct Entry {
+        uint64_t id;
+        uint64_t tick;
+    };
+    
+    bool is_live(const Entry& entry) const {
+        auto it = deadlines_.find(entry.id);
+        return it != deadlines_.end() && it->second == entry.tick;
+    }
+    
+    void collect_due(std::vector<Entry>& slot, uint64_t now_tick, std::vector<uint64_t>& due) {
+        size_t kept = 0;
+        for (const auto& entry : slot) {
+            if (!is_live(entry)) {
+                continue;  // Superseded or cancelled
+            }
+            if (entry.tick <= now_tick) {
+                deadlines_.erase(entry.id);
+                due.push_back(entry.id);
+            } else {
+                slot[kept++] = entry;  // Later round
+            }
+        }
+        slot.resize(kept);
+    }
+    
+    uint64_t tick_floor(Clock::time_point t) const {
+        if (t <= origin_) return 0;
+        return static_cast<uint64_t>((t - origin_) / tick_);
+    }
+    
+    uint64_t tick_ceil(Clock::time_point t) const {
+        if (t <= origin_) return 0;
+        auto elapsed = t - origin_;
+        auto ticks = static_cast<uint64_t>(elapsed / tick_);
+        return (tick_time(ticks) < t) ? ticks + 1 : ticks;
+    }
+    
+    // Signed arithmetic: an unsigned tick count would make past deadlines wrap
+    Clock::time_point tick_time(uint64_t tick) const {
+        return origin_ + tick_ * static_cast<int64_t>(tick);
+    }
+    
+    Clock::time_point origin_;
+    std::chrono::milliseconds tick_;
+    std::vector<std::vector<Entry>> slots_;
+    std::unordered_map<uint64_t, uint64_t> deadlines_;  // id -> tick
+    uint64_t current_ = 0;  // First tick not yet expired
+};
+
+// ============================================================
+// Shared Polling Scheduler
+// ============================================================
+
+/**
+ * @brief Identity, size and modification time of a file from one stat call
+ * 
+ * Linux uses statx() (nanosecond mtime; stat() on kernels without it),
+ * other POSIX systems stat(), Windows GetFileAttributesExW() (no inode).
+ */
+struct FileStamp {
+    bool exists = false;
+    uint64_t dev = 0;
+    uint64_t ino = 0;
+    uint64_t size = 0;
+    int64_t mtime_ns = 0;
+    
+    static FileStamp read(const std::filesystem::path& path) {
+        FileStamp stamp;
+#if defined(__linux__) && defined(STATX_BASIC_STATS)
+        struct statx stx{};
+        if (::statx(AT_FDCWD, path.c_str(), AT_STATX_SYNC_AS_STAT,
+                    STATX_INO | STATX_SIZE | STATX_MTIME, &stx) == 0) {
+            stamp.exists = true;
+            stamp.dev = (static_cast<uint64_t>(stx.stx_dev_major) << 32) | stx.stx_dev_minor;
+            stamp.ino = stx.stx_ino;
+            stamp.size = stx.stx_size;
+            stamp.mtime_ns = static_cast<int64_t>(stx.stx_mtime.tv_sec) * 1000000000 + stx.stx_mtime.tv_nsec;
+            return stamp;
+        }
+        if (errno != ENOSYS) {
+            return stamp;
+        }
+#endif
+#if defined(__linux__) || defined(__APPLE__)
+        struct stat st{};
+        if (::stat(path.c_str(), &st) == 0) {
+#ifdef __APPLE__
+            const auto& mtime = st.st_mtimespec;
+#else
+            const auto& mtime = st.st_mtim;
+#endif
+            stamp.exists = true;
+            stamp.dev = static_cast<uint64_t>(st.st_dev);
+            stamp.ino = static_cast<uint64_t>(st.st_ino);
+            stamp.size = static_cast<uint64_t>(st.st_size);
+            stamp.mtime_ns = static_cast<int64_t>(mtime.tv_sec) * 1000000000 + mtime.tv_nsec;
+        }
+#elif defined(_WIN32)
+        WIN32_FILE_ATTRIBUTE_DATA data{};
+        if (GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data)) {
+            stamp.exists = true;
+            stamp.size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+            const uint64_t ticks = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) |
+                                   data.ftLastWriteTime.dwLowDateTime;
+            stamp.mtime_ns = static_cast<int64_t>(ticks) * 100;  // 100 ns units
+        }
+#else
+        std::error_code ec;
+        auto size = std::filesystem::file_size(path, ec);
+        auto mtime = std::filesystem::last_write_time(path, ec);
+        if (!ec) {
+            stamp.exists = true;
+            stamp.size = static_cast<uint64_t>(size);
+            stamp.mtime_ns = static_cast<int64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count());
         }
+#endif
+        return stamp;
+    }
+    
+    bool operator==(const FileStamp& other) const {
+        return exists == other.exists && dev == other.dev && ino == other.ino &&
+               size == other.size && mtime_ns == other.mtime_ns;
     }
+    bool operator!=(const FileStamp& other) const { return !(*this == other); }
+};
 
+/**
+ * @brief Subscriber callbacks run with the owner's lock released
+ *
+ * Shared dispatchers (inotify set, polling scheduler) queue callbacks while
+ * holding their lock and run them from run() with it released, so a
+ * callback that blocks cannot stall other subscribers or a thread
+ * unsubscribing another one. wait_idle() keeps unsubscribe's guarantee that
+ * the callback never runs afterwards. The lock must be held exactly once.
+ */
+class CallbackQueue {
+public:
+    void push(uint64_t id, std::function<void()> call) {
+        queue_.push_back(Call{id, std::move(call)});
+    }
+    
     /**
-     * @brief Check if value exists
-     * @param json_path JSON path
-     * @return true if exists
+     * @brief Run queued calls whose subscriber is still alive(id)
+     * 
+     * A call is skipped if its subscriber was removed meanwhile. Calls
+     * queued by another thread while this one dispatches run here too.
      */
-    bool has(const std::string& json_path) const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        try {
-            json value = get_value_by_path(json_, json_path);
-            return !value.is_null();
-        } catch (...) {
-            return false;
+    template<typename Lock, typename Alive>
+    void run(Lock& lock, Alive&& alive) {
+        if (dispatching_) {
+            return;  // The dispatching thread picks them up
+        }
+        dispatching_ = true;
+        runner_ = std::this_thread::get_id();
+        std::vector<Call> calls;
+        while (!queue_.empty()) {
+            calls.swap(queue_);
+            for (auto& call : calls) {
+                if (!alive(call.id)) {
+                    continue;
+                }
+                running_ = call.id;
+                lock.unlock();
+                call.fn();
+                lock.lock();
+                running_ = 0;
+                idle_.notify_all();
+            }
+            calls.clear();
         }
+        dispatching_ = false;
+        runner_ = std::thread::id();
     }
-
+    
     /**
-     * @brief Set error callback
-     * @param callback Callback function called on error
+     * @brief Wait until the callback of a removed subscriber is not running
+     * 
+     * Returns at once when called from that callback itself.
      */
-    void set_error_callback(ErrorCallback callback) {
-        error_callback_ = std::move(callback);
+    template<typename Lock>
+    void wait_idle(Lock& lock, uint64_t id) {
+        idle_.wait(lock, [&] {
+            return running_ != id || runner_ == std::this_thread::get_id();
+        });
     }
 
-    /**
-     * @brief Get last error
-     * @return Error information
-     */
-    const ErrorInfo& last_error() const {
-        return last_error_;
-    }
+private:
+    struct Call {
+        uint64_t id;
+        std::function<void()> fn;
+    };
+    
+    std::vector<Call> queue_;
+    bool dispatching_ = false;
+    std::thread::id runner_;
+    uint64_t running_ = 0;  ///< Subscriber whose callback is running (0: none)
+    std::condition_variable_any idle_;
+};
 
+/**
+ * @brief Process-wide polling loop for watchers without native support
+ * 
+ * One thread serves every polled file from a timer wheel. Files that come
+ * due together are stat'ed in one batch outside the lock, so a slow
+ * filesystem (NFS) does not hold up subscribe/unsubscribe. Each file keeps
+ * its own adaptive interval: min_interval after a change, doubling after
+ * 10 unchanged polls up to max_interval.
+ */
+class PollScheduler {
+public:
+    using Callback = std::function<void()>;
+    using Clock = TimerWheel::Clock;
+    
+    static constexpr std::chrono::milliseconds initial_interval{50};
+    static constexpr std::chrono::milliseconds min_interval{10};
+    static constexpr std::chrono::milliseconds max_interval{500};
+    
     /**
-     * @brief Save current JSON to file
-     * @param pretty Whether to format output
-     * @return true if successful
+     * @brief Get the shared scheduler
+     * 
+     * Created on first use and intentionally never destroyed: watchers
+     * owned by static objects may unsubscribe during program exit.
      */
-    bool save(bool pretty = true) const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        try {
-            std::ofstream file(file_path_);
-            if (!file) {
-                handle_error(ErrorType::FileAccessDenied, 
-                           "Failed to open file for writing: " + file_path_);
-                return false;
-            }
-            
-            if (pretty) {
-                file << json_.dump(2);  // 2-space indent
-            } else {
-                file << json_.dump();
-            }
-            
-            return true;
-        } catch (const std::exception& e) {
-            handle_error(ErrorType::FileReadError, 
-                        "Failed to save JSON: " + std::string(e.what()));
-            return false;
-        }
+    static PollScheduler& shared() {
+        static PollScheduler* scheduler = [] {
+            auto* created = new PollScheduler();
+            std::thread(&PollScheduler::run, created).detach();
+            return created;
+        }();
+        return *scheduler;
     }
-
+    
     /**
-     * @brief Set JSON (change value from program)
-     * @param json_path JSON path
-     * @param value Value to set
-     * @return true if successful
+     * @brief Poll a file
+     * @param quiet Report a change once the file has been unchanged this long (0 = at once)
+     * @return Subscription id
      */
-    template<typename T>
-    bool set(const std::string& json_path, const T& value) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        try {
-            set_value_by_path(json_, json_path, value);
-            return true;
-        } catch (const std::exception& e) {
-            handle_error(ErrorType::ParseError, 
-                        "Failed to set value at '" + json_path + "': " + e.what());
-            return false;
-        }
+    uint64_t subscribe(const std::filesystem::path& path, std::chrono::milliseconds quiet,
+                       Callback callback) {
+        auto stamp = FileStamp::read(path);
+        std::lock_guard<std::recursive_mutex> lock(mtx_);
+        uint64_t id = next_id_++;
+        Entry entry;
+        entry.path = path;
+        entry.quiet = quiet;
+        entry.callback = std::make_shared<Callback>(std::move(callback));
+        entry.stamp = stamp;
+        entries_.emplace(id, std::move(entry));
+        timers_.schedule(id, Clock::now() + initial_interval);
+        cv_.notify_one();
+        return id;
     }
-
+    
     /**
-     * @brief Get file path
+     * @brief Stop polling a file
+     * 
+     * Returns after its callback, if running on the scheduler thread, has
+     * finished, so the callback is never invoked afterwards. Callbacks run
+     * without the scheduler's lock: removing other files never waits.
      */
-    const std::string& file_path() const {
-        return file_path_;
+    void unsubscribe(uint64_t id) {
+        std::unique_lock<std::recursive_mutex> lock(mtx_);
+        timers_.cancel(id);
+        entries_.erase(id);
+        calls_.wait_idle(lock, id);
     }
-
-    /**
-     * @brief For debugging: Get entire current JSON as string
-     */
-    std::string dump(int indent = 2) const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return json_.dump(indent);
+    
+    size_t size() {
+        std::lock_guard<std::recursive_mutex> lock(mtx_);
+        return entries_.size();
     }
 
 private:
-    /**
-     * @brief Load JSON file
-     */
-    bool load() {
-        try {
-            std::ifstream file(file_path_);
-            if (!file) {
-                handle_error(ErrorType::FileNotFound, 
-                           "File not found: " + file_path_);
-                return false;
+    struct Entry {
+        std::filesystem::path path;
+        std::chrono::milliseconds quiet{0};
+        std::shared_ptr<Callback> callback;  // Kept alive while running
+        FileStamp stamp;
+        std::chrono::milliseconds interval = initial_interval;
+        int unchanged = 0;
+        std::optional<Clock::time_point> fire_at;  // Change seen; waiting for `quiet`
+    };
+    
+    void run() {
+        std::unique_lock<std::recursive_mutex> lock(mtx_);
+        std::vector<std::pair<uint64_t, std::filesystem::path>> due;
+        std::vector<FileStamp> stamps;
+        
+        for (;;) {
+            int timeout = timers_.next_timeout(Clock::now());
+            if (timeout < 0) {
+                cv_.wait(lock);
+                continue;
+            }
+            if (timeout > 0) {
+                cv_.wait_for(lock, std::chrono::milliseconds(timeout));
+                continue;
             }
             
-            std::lock_guard<std::mutex> lock(mutex_);
+            due.clear();
+            timers_.expire(Clock::now(), [&](uint64_t id) {
+                auto it = entries_.find(id);
+                if (it != entries_.end()) {
+                    due.emplace_back(id, it->second.path);
+                }
+            });
             
-            // Empty file check
-            file.seekg(0, std::ios::end);
-            if (file.tellg() == 0) {
-                json_ = json::object();  // Initialize as empty object
-                return true;
+            // Stat the batch unlocked; entries may be removed meanwhile
+            lock.unlock();
+            stamps.clear();
+            for (const auto& file : due) {
+                stamps.push_back(FileStamp::read(file.second));
             }
-            file.seekg(0, std::ios::beg);
+            lock.lock();
             
-            // JSON parse
-            try {
-                file >> json_;
-            } catch (const json::parse_error& e) {
-                handle_error(ErrorType::ParseError, 
-                           "JSON parse error: " + std::string(e.what()));
-                return false;
+            const auto now = Clock::now();
+            for (size_t i = 0; i < due.size(); ++i) {
+                auto it = entries_.find(due[i].first);
+                if (it != entries_.end()) {
+                    apply(due[i].first, it->second, stamps[i], now);
+                }
             }
-            
-            return true;
-            
-        } catch (const std::exception& e) {
-            handle_error(ErrorType::FileReadError, 
-                        "Failed to read file: " + std::string(e.what()));
-            return false;
+            calls_.run(lock, [this](uint64_t id) { return entries_.count(id) != 0; });
         }
     }
-
-    /**
-     * @brief Get value by JSON path
-     * @param j JSON object
-     * @param path Path (dot-separated, e.g., "player.speed")
-     * @return Value (null if not found)
-     */
-    static json get_value_by_path(const json& j, const std::string& path) {
-        if (path.empty()) {
-            return j;
-        }
-        
-        json current = j;
-        std::string token;
-        std::istringstream path_stream(path);
-        
-        while (std::getline(path_stream, token, '.')) {
-            // Array access support: "array[0]"
-            size_t bracket_pos = token.find('[');
-            if (bracket_pos != std::string::npos) {
-                std::string key = token.substr(0, bracket_pos);
-                size_t bracket_end = token.find(']', bracket_pos);
-                if (bracket_end == std::string::npos) {
-                    throw std::runtime_error("Invalid array syntax in path: " + path);
-                }
-                
-                std::string index_str = token.substr(bracket_pos + 1, bracket_end - bracket_pos - 1);
-                int index = std::stoi(index_str);
-                
-                if (!key.empty()) {
-                    if (!current.contains(key) || !current[key].is_array()) {
-                        return json{};
-                    }
-                    current = current[key];
-                }
-                
-                if (index < 0 || static_cast<size_t>(index) >= current.size()) {
-                    return json{};
-                }
-                current = current[index];
-            } else {
-                if (!current.is_object() || !current.contains(token)) {
-                    return json{};
+    
+    void apply(uint64_t id, Entry& entry, const FileStamp& stamp, Clock::time_point now) {
+        bool fire = false;
+        if (stamp != entry.stamp) {
+            entry.stamp = stamp;
+            entry.interval = min_interval;
+            entry.unchanged = 0;
+            if (stamp.exists) {  // A removed file has nothing to read
+                if (entry.quiet.count() > 0) {
+                    entry.fire_at = now + entry.quiet;
+                } else {
+                    fire = true;
                 }
-                current = current[token];
             }
+        } else if (++entry.unchanged > 10 && entry.interval < max_interval) {
+            entry.interval = std::min(entry.interval * 2, max_interval);
+        }
+        if (entry.fire_at && now >= *entry.fire_at) {
+            entry.fire_at.reset();
+            fire = true;
         }
         
-        return current;
+        auto next = now + entry.interval;
+        if (entry.fire_at) {
+            next = std::min(next, *entry.fire_at);
+        }
+        timers_.schedule(id, next);
+        
+        if (fire) {
+            calls_.push(id, [callback = entry.callback] { (*callback)(); });
+        }
     }
+    
+    std::recursive_mutex mtx_;
+    std::condition_variable_any cv_;
+    uint64_t next_id_ = 1;
+    std::unordered_map<uint64_t, Entry> entries_;
+    TimerWheel timers_;
+    CallbackQueue calls_;  // Run with mtx_ released
+};
+
+#ifdef __linux__
+// ============================================================
+// Shared inotify Reactor (Linux)
+// ============================================================
 
+/**
+ * @brief One inotify instance multiplexing many watched files
+ * 
+ * Each directory is watched once (the kernel hands out one watch
+ * descriptor per inode) and refcounted by the files subscribed in it.
+ * Events are dispatched to subscriptions by watch descriptor and filename
+ * (hash index, compared in place without allocating) and filtered by the
+ * subscription's trigger policy. Stability checks and
+ * debounce windows run from process_timers().
+ * 
+ * Events lost to a queue overflow (IN_Q_OVERFLOW) or to a watch the kernel
+ * dropped (IN_IGNORED: directory removed, renamed over or unmounted) are
+ * recovered by re-arming the watches and comparing each file's stat with
+ * its state at the last report; a file that differs is reported as changed.
+ * 
+ * With Options::follow_symlinks the subscription watches the file its
+ * symlink chain resolves to, plus every link in the chain. When a link is
+ * replaced (e.g. a Kubernetes ConfigMap swapping `..data`), the chain is
+ * resolved again and, if it now leads to another file, the watch moves
+ * there and one change is reported.
+ */
+class InotifySet {
+public:
+    using EventCallback = std::function<void(uint32_t mask)>;
+    
+    struct Options {
+        std::chrono::milliseconds debounce{0};
+        TriggerPolicy trigger = TriggerPolicy::WriteComplete;
+        std::chrono::milliseconds settle_interval{50};
+        /// Notified before a resync with IN_Q_OVERFLOW and/or IN_IGNORED (optional)
+        std::function<void(uint32_t cause)> on_resync;
+        /// Watch the symlink chain and follow it when a link is replaced
+        bool follow_symlinks = false;
+    };
+    
+    /// Retry interval for a watch whose directory cannot be watched again yet
+    static constexpr std::chrono::milliseconds rearm_interval{250};
+    
+    static constexpr uint32_t watch_mask =
+        IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM;
+    
+    explicit InotifySet(size_t max_events_per_read = 64)
+        : buffer_(max_events_per_read * (sizeof(struct inotify_event) + NAME_MAX + 1)) {}
+    
+    bool open() {
+        fd_.reset(inotify_init1(IN_NONBLOCK | IN_CLOEXEC));
+        return static_cast<bool>(fd_);
+    }
+    
+    int fd() const { return fd_.get(); }
+    
     /**
-     * @brief Set value by JSON path
-     * @param j JSON object
-     * @param path Path (dot-separated)
-     * @param value Value to set
+     * @brief Subscribe to events for one file
+     * @return Subscription id (0 on failure)
      */
-    template<typename T>
-    static void set_value_by_path(json& j, const std::string& path, const T& value) {
-        if (path.empty()) {
-            j = value;
-            return;
+    uint64_t subscribe(const std::filesystem::path& dir, const std::string& filename,
+                       EventCallback callback, const Options& options) {
+        std::lock_guard<std::recursive_mutex> lock(mtx_);
+        std::optional<SymlinkChain> chain;
+        if (options.follow_symlinks) {
+            chain = resolve_chain(dir / filename);  // nullopt on a link loop: watch as given
         }
         
-        json* current = &j;
-        std::string token;
-        std::istringstream path_stream(path);
-        std::vector<std::string> tokens;
+        const auto path = chain ? chain->target : dir / filename;
+        int wd = inotify_add_watch(fd_.get(), path.parent_path().c_str(), watch_mask);
+        if (wd < 0) {
+            return 0;
+        }
         
-        while (std::getline(path_stream, token, '.')) {
-            tokens.push_back(token);
+        uint64_t id = next_id_++;
+        watches_[wd].emplace(name_hash(path.filename().native()), id);
+        Subscription subscription;
+        subscription.wd = wd;
+        subscription.filename = path.filename().string();
+        subscription.path = path;
+        subscription.callback = std::make_shared<EventCallback>(std::move(callback));
+        subscription.options = options;
+        subscription.reported = FileStamp::read(subscription.path);
+        if (chain) {
+            subscription.origin = dir / filename;
         }
+        auto& added = subscriptions_.emplace(id, std::move(subscription)).first->second;
+        if (chain) {
+            watch_links(id, added, chain->links);
+        }
+        return id;
+    }
+    
+    /**
+     * @brief Remove a subscription
+     * 
+     * Returns after its callback, if running on another thread, has
+     * finished, so the callback is never invoked afterwards. Callbacks run
+     * without the set's lock: removing other subscriptions never waits.
+     */
+    void unsubscribe(uint64_t id) {
+        std::unique_lock<std::recursive_mutex> lock(mtx_);
+        remove(id);
+        calls_.wait_idle(lock, id);
+    }
+    
+    /**
+     * @brief Read and dispatch every queued event (non-blocking)
+     * 
+     * Events for the same subscription within one read are merged: its
+     * callback runs once with the combined mask. A queue overflow or a
+     * dropped watch is recovered once the queue is drained.
+     * 
+     * @return Number of callbacks run
+     */
+    size_t process_events() {
+        std::unique_lock<std::recursive_mutex> lock(mtx_);
+        const size_t fired_before = fired_;
         
-        for (size_t i = 0; i < tokens.size() - 1; ++i) {
-            const auto& tok = tokens[i];
-            
-            if (!current->is_object()) {
-                *current = json::object();
-            }
-            
-            if (!current->contains(tok)) {
-                (*current)[tok] = json::object();
-            }
+        for (;;) {
+            ssize_t len = ::read(fd_.get(), buffer_.data(), buffer_.size());
+            if (len < 0 && errno == EINTR) continue;
+            if (len <= 0) break;  // EAGAIN: queue drained
             
-            current = &(*current)[tok];
+            size_t i = 0;
+            while (i < static_cast<size_t>(len)) {
+                const auto* event = reinterpret_cast<const struct inotify_event*>(buffer_.data() + i);
+                i += sizeof(struct inotify_event) + event->len;
+                collect(*event);
+            }
+            dispatch_pending();
         }
-        
-        if (!current->is_object()) {
-            *current = json::object();
+        if (overflowed_ || !lost_watches_.empty()) {
+            recover();
         }
-        
-        (*current)[tokens.back()] = value;
+        const size_t fired = fired_ - fired_before;
+        run_callbacks(lock);
+        return fired;
     }
-
+    
     /**
-     * @brief Handle error
+     * @brief Run due stability checks and elapsed debounce windows
+     * @return Number of callbacks run
      */
-    void handle_error(ErrorType type, const std::string& message) const {
-        last_error_ = ErrorInfo(type, message, file_path_);
-        
-        if (error_callback_) {
-            error_callback_(last_error_);
-        }
+    size_t process_timers() {
+        std::unique_lock<std::recursive_mutex> lock(mtx_);
+        const size_t fired_before = fired_;
+        const auto now = TimerWheel::Clock::now();
+        timers_.expire(now, [this, now](uint64_t id) {
+            auto it = subscriptions_.find(id);
+            if (it == subscriptions_.end()) {
+                return;
+            }
+            auto& subscription = it->second;
+            if (subscription.state == State::Settling) {
+                check_settled(id, subscription, now);
+            } else if (subscription.state == State::Debouncing) {
+                fire(id, subscription);
+            } else if (subscription.state == State::Rearming) {
+                subscription.state = State::Idle;
+                resync(id, subscription, IN_IGNORED, now);
+            }
+        });
+        const size_t fired = fired_ - fired_before;
+        run_callbacks(lock);
+        return fired;
+    }
+    
+    /**
+     * @brief Milliseconds until process_timers() has work (-1 if none)
+     */
+    int next_timeout() {
+        std::lock_guard<std::recursive_mutex> lock(mtx_);
+        return timers_.next_timeout(TimerWheel::Clock::now());
     }
 
 private:
-    std::string file_path_;
-    std::unique_ptr<internal::FileWatcher> watcher_;
-    mutable json json_;
-    mutable std::mutex mutex_;
-    mutable ErrorInfo last_error_;
-    ErrorCallback error_callback_;
-};
-
-/**
- * @brief Automatic binding helper using nlohmann/json
- */
-class NlohmannBinder {
-public:
-    using json = nlohmann::json;
-
-    explicit NlohmannBinder(const std::string& file_path)
-        : params_(file_path)
-    {}
-
+    enum class State {
+        Idle,
+        Settling,    // Written without a completion event; waiting for size/mtime to settle
+        Debouncing,  // Complete; waiting for the debounce window to go quiet
+        Rearming     // Watch lost and the directory could not be watched again yet
+    };
+    
+    struct Subscription {
+        int wd = -1;  // -1 while rearming
+        std::string filename;
+        std::filesystem::path path;
+        std::shared_ptr<EventCallback> callback;  // Kept alive while running; null for links
+        Options options;
+        State state = State::Idle;
+        uint32_t pending_mask = 0;  // Events merged until the callback runs
+        struct stat settle_stat{};  // Last observation while settling
+        FileStamp reported;         // State when the callback last ran
+        
+        // follow_symlinks
+        std::filesystem::path origin;        // Path as subscribed; `path` is its resolution
+        std::vector<uint64_t> links;         // Subscriptions watching the chain's links
+        std::vector<std::filesystem::path> link_paths;
+        uint64_t owner = 0;                  // Set on a link subscription
+    };
+    
+    struct SymlinkChain {
+        std::filesystem::path target;                // Final path (may not exist)
+        std::vector<std::filesystem::path> links;    // Every symlink traversed, in order
+    };
+    
+    static size_t name_hash(std::string_view name) {
+        return std::hash<std::string_view>{}(name);
+    }
+    
     /**
-     * @brief Bind variable
-     * @tparam T Variable type
-     * @param json_path JSON path
-     * @param variable Reference to variable to bind
-     * @param default_value Default value
+     * @brief Resolve a path like realpath(), recording each symlink on the way
+     * @return nullopt on a symlink loop
      */
-    template<typename T>
-    void bind(const std::string& json_path, T& variable, const T& default_value = T{}) {
-        // Set initial value
-        variable = params_.get<T>(json_path, default_value);
+    static std::optional<SymlinkChain> resolve_chain(const std::filesystem::path& path) {
+        std::error_code ec;
+        SymlinkChain chain;
+        auto current = std::filesystem::absolute(path, ec).lexically_normal();
         
-        // Save binding information
-        bindings_.emplace_back([this, json_path, &variable, default_value]() {
-            variable = params_.get<T>(json_path, default_value);
-        });
+        for (int hops = 0; hops < 40; ++hops) {  // SYMLOOP_MAX on Linux
+            std::filesystem::path prefix;
+            bool followed = false;
+            for (auto part = current.begin(); part != current.end(); ++part) {
+                prefix /= *part;
+                if (!std::filesystem::is_symlink(std::filesystem::symlink_status(prefix, ec))) {
+                    continue;
+                }
+                auto target = std::filesystem::read_symlink(prefix, ec);
+                if (ec) {
+                    break;
+                }
+                chain.links.push_back(prefix);
+                auto next = target.is_absolute() ? target : prefix.parent_path() / target;
+                for (++part; part != current.end(); ++part) {
+                    next /= *part;
+                }
+                current = next.lexically_normal();
+                followed = true;
+                break;
+            }
+            if (!followed) {
+                chain.target = current;
+                return chain;
+            }
+        }
+        return std::nullopt;
     }
-
+    
+    void remove(uint64_t id) {
+        auto it = subscriptions_.find(id);
+        if (it == subscriptions_.end()) {
+            return;
+        }
+        
+        for (uint64_t link : it->second.links) {
+            remove(link);
+        }
+        detach(id, it->second);
+        timers_.cancel(id);
+        subscriptions_.erase(it);
+    }
+    
+    /// Run queued callbacks with the lock released (held once by the caller)
+    void run_callbacks(std::unique_lock<std::recursive_mutex>& lock) {
+        calls_.run(lock, [this](uint64_t id) { return subscriptions_.count(id) != 0; });
+    }
+    
+    /// Replace the link subscriptions of `owner` with watches on `links`
+    void watch_links(uint64_t owner, Subscription& subscription,
+                     const std::vector<std::filesystem::path>& links) {
+        auto previous = std::exchange(subscription.links, {});
+        for (uint64_t link : previous) {
+            remove(link);
+        }
+        subscription.link_paths = links;
+        
+        for (const auto& link : links) {
+            int wd = inotify_add_watch(fd_.get(), link.parent_path().c_str(), watch_mask);
+            if (wd < 0) {
+                continue;  // Its directory is gone: the chain changes again before it matters
+            }
+            uint64_t id = next_id_++;
+            watches_[wd].emplace(name_hash(link.filename().native()), id);
+            Subscription watch;
+            watch.wd = wd;
+            watch.filename = link.filename().string();
+            watch.path = link;
+            watch.owner = owner;
+            subscriptions_.emplace(id, std::move(watch));
+            subscription.links.push_back(id);
+        }
+    }
+    
     /**
-     * @brief Check for updates and update all bound variables
-     * @return true if updated
+     * @brief Resolve a follow_symlinks subscription again after a link event
+     * 
+     * A chain that currently leads nowhere (a link removed before being
+     * recreated) is left alone until it resolves to an existing file.
+     * 
+     * @return true if the subscription moved to another file (reported)
      */
-    bool update() {
-        if (!params_.update()) {
+    bool relink(uint64_t id, TimerWheel::Clock::time_point now) {
+        auto it = subscriptions_.find(id);
+        if (it == subscriptions_.end()) {
+            return false;
+        }
+        auto& subscription = it->second;
+        auto chain = resolve_chain(subscription.origin);
+        std::error_code ec;
+        if (!chain || !std::filesystem::exists(chain->target, ec)) {
             return false;
         }
         
-        // Update all bound variables
-        for (auto& binding : bindings_) {
-            binding();
+        if (chain->links != subscription.link_paths) {
+            watch_links(id, subscription, chain->links);
+        }
+        if (chain->target == subscription.path) {
+            return false;
         }
         
+        detach(id, subscription);
+        subscription.path = chain->target;
+        subscription.filename = chain->target.filename().string();
+        if (rearm(id, subscription, now)) {
+            report(id, subscription, IN_MOVED_TO, now);
+        }
         return true;
     }
-
-    /**
-     * @brief Get the underlying NlohmannParams
-     */
-    NlohmannParams& params() {
-        return params_;
-    }
-
-    const NlohmannParams& params() const {
-        return params_;
-    }
-
-private:
-    NlohmannParams params_;
-    std::vector<std::function<void()>> bindings_;
-};
-
-#endif // LIVETUNER_USE_NLOHMANN_JSON
-
-} // namespace livetuner
-
-// ============================================================
-// Test Support
-// ============================================================
-
-/**
- * LIVETUNER_ENABLE_TEST_SUPPORT provides testing utilities:
- * TestFixture, ITuner/IParams interfaces, adapters, factories.
- * 
- * Usage: #define LIVETUNER_ENABLE_TEST_SUPPORT before including.
- */
-#ifdef LIVETUNER_ENABLE_TEST_SUPPORT
-#include "LiveTunerTest.h"
-#endif
-
-/*
- * ============================================================================
- * LICENSE INFORMATION
- * ============================================================================
- * 
- * This library includes picojson (2-clause BSD License).
- * Copyright 2009-2010 Cybozu Labs, Inc., 2011-2014 Kazuho Oku.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *
- * 1. Redistributions of source code must retain the above copyright notice,
- *    this list of conditions and the following disclaimer.
- *
- * 2. Redistributions in binary form must reproduce the above copyright notice,
- *    this list of conditions and the following disclaimer in the documentation
- *    and/or other materials provided with the distribution.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
- * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
- * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
- * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
- * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
- * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
- * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
- * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
- * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
- * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
- * POSSIBILITY OF SUCH DAMAGE.
- * ----------------------------------------------------------------------------
- */ 
-
-// ============================================================================
-// IMPLEMENTATION SECTION
-// ============================================================================
-// Define LIVETUNER_IMPLEMENTATION in ONE source file before including.
-// Without it, FileWatcher uses polling mode only.
-// ============================================================================
-
-#ifdef LIVETUNER_IMPLEMENTATION
-
-// ============================================================
-// MSVC warning suppression
-// ============================================================
-// Suppress warnings from platform headers (Windows.h, etc.)
-#if defined(_MSC_VER)
-#pragma warning(push, 0)
-#endif
-
-// ============================================================
-// Platform-specific headers (only in implementation)
-// ============================================================
-
-#ifdef _WIN32
-// Settings to prevent Windows.h macro pollution
-#ifndef LIVETUNER_NO_WIN32_LEAN
-#ifndef WIN32_LEAN_AND_MEAN
-#define WIN32_LEAN_AND_MEAN
-#define LIVETUNER_IMPL_DEFINED_WIN32_LEAN_AND_MEAN
-#endif
-#ifndef VC_EXTRALEAN
-#define VC_EXTRALEAN
-#define LIVETUNER_IMPL_DEFINED_VC_EXTRALEAN
-#endif
-#endif
-
-#ifndef LIVETUNER_NO_NOMINMAX
-#ifndef NOMINMAX
-#define NOMINMAX
-#define LIVETUNER_IMPL_DEFINED_NOMINMAX
-#endif
-#endif
-
-#include <windows.h>
-
-// Restore defined macros
-#ifdef LIVETUNER_IMPL_DEFINED_WIN32_LEAN_AND_MEAN
-#undef WIN32_LEAN_AND_MEAN
-#undef LIVETUNER_IMPL_DEFINED_WIN32_LEAN_AND_MEAN
-#endif
-#ifdef LIVETUNER_IMPL_DEFINED_VC_EXTRALEAN
-#undef VC_EXTRALEAN
-#undef LIVETUNER_IMPL_DEFINED_VC_EXTRALEAN
-#endif
-#ifdef LIVETUNER_IMPL_DEFINED_NOMINMAX
-#undef NOMINMAX
-#undef LIVETUNER_IMPL_DEFINED_NOMINMAX
-#endif
-
-#elif defined(__linux__)
-#include <sys/inotify.h>
-#include <unistd.h>
-#include <poll.h>
-#include <limits.h>
-#include <cerrno>
-#elif defined(__APPLE__)
-#include <CoreServices/CoreServices.h>
-#endif
-
-namespace livetuner {
-namespace internal {
-
-// ============================================================
-// RAII Resource Wrappers Implementation
-// ============================================================
-
-#ifdef _WIN32
-struct HandleDeleter {
-    void operator()(HANDLE h) const noexcept {
-        if (h != nullptr && h != INVALID_HANDLE_VALUE) {
-            CloseHandle(h);
+    
+    void collect(const struct inotify_event& event) {
+        if (event.mask & IN_Q_OVERFLOW) {
+            overflowed_ = true;
+            return;
+        }
+        if (event.mask & IN_IGNORED) {
+            // Also queued after our own inotify_rm_watch; that wd is no longer in watches_
+            if (watches_.count(event.wd) != 0) {
+                lost_watches_.push_back(event.wd);
+            }
+            return;
+        }
+        if (event.len == 0) {
+            return;
+        }
+        auto watch = watches_.find(event.wd);
+        if (watch == watches_.end()) {
+            return;
+        }
+        
+        // The name is NUL-padded to event.len; view it in place
+        const std::string_view name(event.name, ::strnlen(event.name, event.len));
+        auto range = watch->second.equal_range(name_hash(name));
+        for (auto file = range.first; file != range.second; ++file) {
+            if (subscriptions_.at(file->second).filename != name) {
+                continue;  // Hash collision
+            }
+            auto merged = std::find_if(pending_.begin(), pending_.end(),
+                [&](const auto& entry) { return entry.first == file->second; });
+            if (merged != pending_.end()) {
+                merged->second |= event.mask;
+            } else {
+                pending_.emplace_back(file->second, event.mask);
+            }
         }
     }
-};
-
-struct InvalidHandleDeleter {
-    void operator()(HANDLE h) const noexcept {
-        if (h != INVALID_HANDLE_VALUE) {
-            CloseHandle(h);
+    
+    void dispatch_pending() {
+        // Swap out first: relinking may remove link subscriptions
+        std::vector<std::pair<uint64_t, uint32_t>> batch;
+        batch.swap(pending_);
+        const auto now = TimerWheel::Clock::now();
+        for (const auto& [id, mask] : batch) {
+            auto it = subscriptions_.find(id);
+            if (it == subscriptions_.end()) {
+                continue;  // Unsubscribed by an earlier callback
+            }
+            if (it->second.owner != 0) {
+                relink(it->second.owner, now);  // A link in the chain was replaced
+                continue;
+            }
+            on_events(id, it->second, mask, now);
+        }
+        batch.clear();
+        if (pending_.empty()) {
+            pending_.swap(batch);  // Keep the capacity
         }
     }
-};
-
-using UniqueHandle = std::unique_ptr<std::remove_pointer_t<HANDLE>, HandleDeleter>;
-using UniqueInvalidHandle = std::unique_ptr<std::remove_pointer_t<HANDLE>, InvalidHandleDeleter>;
-
-inline UniqueHandle make_unique_handle(HANDLE h) {
-    return UniqueHandle(h);
-}
-
-inline UniqueInvalidHandle make_unique_invalid_handle(HANDLE h) {
-    return UniqueInvalidHandle(h);
-}
-#endif // _WIN32
-
-#ifdef __linux__
-class UniqueFd {
-public:
-    UniqueFd() : fd_(-1) {}
-    explicit UniqueFd(int fd) : fd_(fd) {}
-    ~UniqueFd() { reset(); }
     
-    UniqueFd(const UniqueFd&) = delete;
-    UniqueFd& operator=(const UniqueFd&) = delete;
+    void on_events(uint64_t id, Subscription& subscription, uint32_t mask,
+                   TimerWheel::Clock::time_point now) {
+        if (subscription.options.trigger == TriggerPolicy::AnyWrite) {
+            if (mask & (IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO)) {
+                report(id, subscription, mask, now);
+            }
+            return;
+        }
+        
+        if (mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+            report(id, subscription, mask, now);  // Writer closed, or renamed into place
+        } else if (mask & IN_MODIFY) {
+            // Still being written: report once size and mtime stop changing,
+            // unless a close or rename arrives first
+            subscription.pending_mask |= mask;
+            subscription.state = State::Settling;
+            if (::stat(subscription.path.c_str(), &subscription.settle_stat) != 0) {
+                subscription.settle_stat = {};
+            }
+            timers_.schedule(id, now + subscription.options.settle_interval);
+        }
+        // CREATE alone is followed by CLOSE_WRITE; DELETE/MOVED_FROM leave nothing to read
+    }
     
-    UniqueFd(UniqueFd&& other) noexcept : fd_(other.fd_) {
-        other.fd_ = -1;
+    void check_settled(uint64_t id, Subscription& subscription, TimerWheel::Clock::time_point now) {
+        struct stat st{};
+        if (::stat(subscription.path.c_str(), &st) != 0) {
+            subscription.state = State::Idle;  // Gone; a later create/rename reports it
+            subscription.pending_mask = 0;
+            return;
+        }
+        
+        const auto& last = subscription.settle_stat;
+        if (st.st_size == last.st_size &&
+            st.st_mtim.tv_sec == last.st_mtim.tv_sec &&
+            st.st_mtim.tv_nsec == last.st_mtim.tv_nsec) {
+            report(id, subscription, 0, now);
+        } else {
+            subscription.settle_stat = st;
+            timers_.schedule(id, now + subscription.options.settle_interval);
+        }
     }
     
-    UniqueFd& operator=(UniqueFd&& other) noexcept {
-        if (this != &other) {
-            reset();
-            fd_ = other.fd_;
-            other.fd_ = -1;
+    void report(uint64_t id, Subscription& subscription, uint32_t mask,
+                TimerWheel::Clock::time_point now) {
+        subscription.pending_mask |= mask;
+        if (subscription.options.debounce.count() > 0) {
+            // Every completed write pushes the deadline out: report once it is quiet
+            subscription.state = State::Debouncing;
+            timers_.schedule(id, now + subscription.options.debounce);
+        } else {
+            timers_.cancel(id);
+            fire(id, subscription);
         }
-        return *this;
     }
     
-    int get() const noexcept { return fd_; }
-    int release() noexcept {
-        int fd = fd_;
-        fd_ = -1;
-        return fd;
+    /**
+     * @brief Re-arm lost watches and resync the affected subscriptions
+     * 
+     * After an overflow every subscription is affected; after IN_IGNORED
+     * the ones on that watch descriptor.
+     */
+    void recover() {
+        std::vector<std::pair<uint64_t, uint32_t>> affected;
+        if (std::exchange(overflowed_, false)) {
+            for (const auto& entry : subscriptions_) {
+                affected.emplace_back(entry.first, static_cast<uint32_t>(IN_Q_OVERFLOW));
+            }
+        }
+        for (int wd : lost_watches_) {
+            auto watch = watches_.find(wd);
+            if (watch == watches_.end()) {
+                continue;
+            }
+            for (const auto& file : watch->second) {
+                subscriptions_.at(file.second).wd = -1;
+                auto merged = std::find_if(affected.begin(), affected.end(),
+                    [&](const auto& entry) { return entry.first == file.second; });
+                if (merged != affected.end()) {
+                    merged->second |= IN_IGNORED;
+                } else {
+                    affected.emplace_back(file.second, static_cast<uint32_t>(IN_IGNORED));
+                }
+            }
+            watches_.erase(watch);  // The kernel already removed it
+        }
+        lost_watches_.clear();
+        
+        // Queued before any report of the resync below, so they run first
+        for (const auto& [id, cause] : affected) {
+            auto it = subscriptions_.find(id);
+            if (it != subscriptions_.end() && it->second.options.on_resync) {
+                calls_.push(id, [on_resync = it->second.options.on_resync, cause = cause] {
+                    on_resync(cause);
+                });
+            }
+        }
+        const auto now = TimerWheel::Clock::now();
+        for (const auto& [id, cause] : affected) {
+            auto it = subscriptions_.find(id);
+            if (it != subscriptions_.end()) {
+                resync(id, it->second, cause, now);
+            }
+        }
     }
     
-    void reset(int fd = -1) noexcept {
-        if (fd_ >= 0) {
-            close(fd_);
+    void resync(uint64_t id, Subscription& subscription, uint32_t cause,
+                TimerWheel::Clock::time_point now) {
+        if (!rearm(id, subscription, now)) {
+            return;
+        }
+        if (subscription.owner != 0) {
+            relink(subscription.owner, now);  // May remove this link subscription
+            return;
+        }
+        if (!subscription.origin.empty() && relink(id, now)) {
+            return;
+        }
+        auto current = FileStamp::read(subscription.path);
+        // A file that is gone has nothing to read; its re-creation is reported
+        if (current.exists && current != subscription.reported) {
+            report(id, subscription, cause, now);
         }
-        fd_ = fd;
     }
     
-    explicit operator bool() const noexcept { return fd_ >= 0; }
+    /**
+     * @brief Make sure the subscription's directory is watched
+     * 
+     * inotify_add_watch() returns the existing descriptor for a directory
+     * that is still watched, or a new one if it was replaced.
+     * 
+     * @return false if it cannot be watched now (retried after rearm_interval)
+     */
+    bool rearm(uint64_t id, Subscription& subscription, TimerWheel::Clock::time_point now) {
+        int wd = inotify_add_watch(fd_.get(), subscription.path.parent_path().c_str(), watch_mask);
+        if (wd < 0) {
+            detach(id, subscription);
+            subscription.state = State::Rearming;
+            subscription.pending_mask = 0;
+            timers_.schedule(id, now + rearm_interval);
+            return false;
+        }
+        if (wd != subscription.wd) {
+            detach(id, subscription);
+            subscription.wd = wd;
+            watches_[wd].emplace(name_hash(subscription.filename), id);
+        }
+        return true;
+    }
+    
+    /// Remove the subscription from its watch, dropping the watch with its last file
+    void detach(uint64_t id, Subscription& subscription) {
+        auto watch = watches_.find(subscription.wd);
+        if (watch != watches_.end()) {
+            auto range = watch->second.equal_range(name_hash(subscription.filename));
+            for (auto file = range.first; file != range.second; ++file) {
+                if (file->second == id) {
+                    watch->second.erase(file);
+                    break;
+                }
+            }
+            if (watch->second.empty()) {
+                inotify_rm_watch(fd_.get(), watch->first);
+                watches_.erase(watch);
+            }
+        }
+        subscription.wd = -1;
+    }
+    
+    void fire(uint64_t id, Subscription& subscription) {
+        subscription.state = State::Idle;
+        subscription.reported = FileStamp::read(subscription.path);
+        uint32_t mask = std::exchange(subscription.pending_mask, 0u);
+        ++fired_;
+        calls_.push(id, [callback = subscription.callback, mask] { (*callback)(mask); });
+    }
     
+    UniqueFd fd_;
+    std::vector<char> buffer_;
+    std::recursive_mutex mtx_;
+    uint64_t next_id_ = 1;
+    size_t fired_ = 0;
+    std::unordered_map<int, std::unordered_multimap<size_t, uint64_t>> watches_;  // wd -> filename hash -> id
+    std::unordered_map<uint64_t, Subscription> subscriptions_;
+    std::vector<std::pair<uint64_t, uint32_t>> pending_;  // Merged masks of the current read
+    bool overflowed_ = false;        // IN_Q_OVERFLOW seen since the last recover()
+    std::vector<int> lost_watches_;  // IN_IGNORED watch descriptors since the last recover()
+    TimerWheel timers_;
+    CallbackQueue calls_;  // Callbacks and on_resync hooks, run with mtx_ released
+};
+
+/**
+ * @brief Process-wide inotify set serviced by a single thread
+ * 
+ * Shared by every FileWatcher, so N watchers cost one inotify instance,
+ * one thread and one event buffer instead of N of each.
+ */
+class InotifyReactor {
+public:
+    /**
+     * @brief Get the shared reactor (nullptr if inotify is unavailable)
+     * 
+     * Created on first use and intentionally never destroyed: watchers
+     * owned by static objects may unsubscribe during program exit.
+     */
+    static InotifyReactor* shared() {
+        static std::mutex mtx;
+        static InotifyReactor* reactor = nullptr;
+        
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!reactor) {
+            auto candidate = std::make_unique<InotifyReactor>();
+            if (candidate->set_.open()) {
+                reactor = candidate.release();
+                std::thread(&InotifyReactor::run, reactor).detach();
+            }
+        }
+        return reactor;
+    }
+    
+    InotifyReactor() : set_(1024) {}
+    
+    InotifySet& set() { return set_; }
+
 private:
-    int fd_;
+    void run() {
+        struct pollfd fds[1];
+        fds[0].fd = set_.fd();
+        fds[0].events = POLLIN;
+        
+        for (;;) {
+            int poll_result = poll(fds, 1, set_.next_timeout());
+            if (poll_result < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            if (poll_result > 0 && (fds[0].revents & POLLIN)) {
+                set_.process_events();
+            }
+            set_.process_timers();
+        }
+    }
+    
+    InotifySet set_;
 };
 #endif // __linux__
 
@@ -3796,6 +7330,8 @@ private:
 // ============================================================
 
 struct FileWatcher::Impl {
+    uint64_t poll_subscription = 0;        // PollScheduler fallback
+
 #ifdef _WIN32
     UniqueInvalidHandle dir_handle;
     UniqueHandle stop_event;
@@ -3803,12 +7339,9 @@ struct FileWatcher::Impl {
 #endif
 
 #ifdef __linux__
-    UniqueFd inotify_fd;
-    int dir_watch_fd = -1;
-    UniqueFd pipe_read_fd;
-    UniqueFd pipe_write_fd;
-    std::string target_filename;
-    std::filesystem::path dir_path;
+    InotifySet* set = nullptr;             // Shared reactor's set, or own_set
+    std::unique_ptr<InotifySet> own_set;   // Thread-less mode only
+    uint64_t subscription = 0;
 #endif
 
 #ifdef __APPLE__
@@ -3834,11 +7367,11 @@ inline FileWatcher::FileWatcher(FileWatcher&& other) noexcept
     , file_path_(std::move(other.file_path_))
     , callback_(std::move(other.callback_))
     , running_(other.running_.load())
-    , change_detected_(other.change_detected_.load())
+    , change_generation_(other.change_generation_.load())
+    , consumed_generation_(other.consumed_generation_)
     , watcher_thread_(std::move(other.watcher_thread_))
     , config_(std::move(other.config_)) {
     other.running_.store(false);
-    other.change_detected_.store(false);
 }
 
 inline FileWatcher& FileWatcher::operator=(FileWatcher&& other) noexcept {
@@ -3848,11 +7381,11 @@ inline FileWatcher& FileWatcher::operator=(FileWatcher&& other) noexcept {
         file_path_ = std::move(other.file_path_);
         callback_ = std::move(other.callback_);
         running_.store(other.running_.load());
-        change_detected_.store(other.change_detected_.load());
+        change_generation_.store(other.change_generation_.load());
+        consumed_generation_ = other.consumed_generation_;
         watcher_thread_ = std::move(other.watcher_thread_);
         config_ = std::move(other.config_);
         other.running_.store(false);
-        other.change_detected_.store(false);
     }
     return *this;
 }
@@ -3880,52 +7413,82 @@ inline void FileWatcher::stop() {
     if (!running_.load()) {
         return;
     }
-    running_.store(false);
-    
     {
+        // Under the lock so a waiter cannot miss the wakeup
         std::lock_guard<std::mutex> lock(cv_mtx_);
-        change_detected_.store(true);
+        running_.store(false);
     }
     cv_.notify_all();
 
     stop_native();
+    stop_polling();
 
     if (watcher_thread_.joinable()) {
         watcher_thread_.join();
     }
 }
 
-inline bool FileWatcher::wait_for_change(std::chrono::milliseconds timeout) {
+inline bool FileWatcher::wait_for_change(uint64_t& last_seen, std::chrono::milliseconds timeout) {
     std::unique_lock<std::mutex> lock(cv_mtx_);
-    
-    if (change_detected_.load()) {
-        change_detected_.store(false);
-        return true;
-    }
-    
-    bool result = cv_.wait_for(lock, timeout, [this] {
-        return change_detected_.load() || !running_.load();
+    cv_.wait_for(lock, timeout, [&] {
+        return change_generation_.load() != last_seen || !running_.load();
     });
     
-    if (result && change_detected_.load()) {
-        change_detected_.store(false);
-        return true;
+    uint64_t generation = change_generation_.load();
+    if (generation == last_seen) {
+        return false;
     }
-    return false;
+    last_seen = generation;
+    return true;
+}
+
+inline bool FileWatcher::wait_for_change(std::chrono::milliseconds timeout) {
+    return wait_for_change(consumed_generation_, timeout);
 }
 
 inline void FileWatcher::wait_for_change() {
     std::unique_lock<std::mutex> lock(cv_mtx_);
     cv_.wait(lock, [this] {
-        return change_detected_.load() || !running_.load();
+        return change_generation_.load() != consumed_generation_ || !running_.load();
     });
-    change_detected_.store(false);
+    consumed_generation_ = change_generation_.load();
 }
 
 inline bool FileWatcher::is_running() const {
     return running_.load();
 }
 
+#ifdef __linux__
+inline int FileWatcher::event_fd() const {
+    return impl_ && impl_->own_set ? impl_->own_set->fd() : -1;
+}
+
+inline bool FileWatcher::process_events() {
+    if (!impl_ || !impl_->own_set) {
+        return false;
+    }
+    size_t fired = impl_->own_set->process_events();
+    fired += impl_->own_set->process_timers();
+    return fired > 0;
+}
+
+inline int FileWatcher::next_timeout() const {
+    return impl_ && impl_->own_set ? impl_->own_set->next_timeout() : -1;
+}
+#else
+inline int FileWatcher::event_fd() const {
+    return -1;
+}
+
+inline bool FileWatcher::process_events() {
+    return false;
+}
+
+inline int FileWatcher::next_timeout() const {
+    return -1;
+}
+#endif
+
 inline bool FileWatcher::has_native_support() {
 #if defined(_WIN32) || defined(__linux__) || defined(__APPLE__)
     return true;
@@ -3937,7 +7500,7 @@ inline bool FileWatcher::has_native_support() {
 inline void FileWatcher::notify_change() {
     {
         std::lock_guard<std::mutex> lock(cv_mtx_);
-        change_detected_.store(true);
+        change_generation_.fetch_add(1, std::memory_order_acq_rel);
     }
     cv_.notify_all();
     
@@ -3947,38 +7510,21 @@ inline void FileWatcher::notify_change() {
 }
 
 inline bool FileWatcher::start_polling() {
-    watcher_thread_ = std::thread([this] { watch_polling(); });
+    // WriteComplete: report once the file has been stable for settle_interval
+    // (polling sees no close events)
+    auto quiet = config_.debounce;
+    if (config_.trigger == TriggerPolicy::WriteComplete) {
+        quiet = std::max(quiet, config_.settle_interval);
+    }
+    impl_->poll_subscription = PollScheduler::shared().subscribe(
+        file_path_, quiet, [this] { notify_change(); });
     return true;
 }
 
-inline void FileWatcher::watch_polling() {
-    auto last_modify_time = std::filesystem::file_time_type::min();
-    
-    std::chrono::milliseconds poll_interval{50};
-    constexpr std::chrono::milliseconds min_interval{10};
-    constexpr std::chrono::milliseconds max_interval{500};
-    int no_change_count = 0;
-
-    while (running_.load()) {
-        std::error_code ec;
-        auto current_time = std::filesystem::last_write_time(file_path_, ec);
-        
-        if (!ec && current_time != last_modify_time) {
-            last_modify_time = current_time;
-            notify_change();
-            poll_interval = min_interval;
-            no_change_count = 0;
-        } else {
-            ++no_change_count;
-            if (no_change_count > 10 && poll_interval < max_interval) {
-                poll_interval = std::min(poll_interval * 2, max_interval);
-            }
-        }
-
-        std::unique_lock<std::mutex> lock(cv_mtx_);
-        cv_.wait_for(lock, poll_interval, [this] {
-            return !running_.load();
-        });
+inline void FileWatcher::stop_polling() {
+    if (impl_->poll_subscription != 0) {
+        PollScheduler::shared().unsubscribe(impl_->poll_subscription);
+        impl_->poll_subscription = 0;
     }
 }
 
@@ -4028,66 +7574,112 @@ inline bool FileWatcher::start_native() {
         overlapped.hEvent = overlapped_event.get();
 
         auto filename = file_path_.filename().wstring();
+        bool read_pending = false;
+        std::optional<std::chrono::steady_clock::time_point> fire_at;  // Deferred notification
+
+        // WriteComplete: no close events here, so a write is complete once
+        // the file can be opened deny-write (no writer holds it open)
+        auto write_complete = [this] {
+            HANDLE handle = CreateFileW(
+                file_path_.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ,
+                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (handle == INVALID_HANDLE_VALUE) {
+                return GetLastError() != ERROR_SHARING_VIOLATION;
+            }
+            CloseHandle(handle);
+            return true;
+        };
 
         while (running_.load()) {
-            ResetEvent(overlapped.hEvent);
-
-            BOOL result = ReadDirectoryChangesW(
-                impl_->dir_handle.get(),
-                buffer.data(),
-                static_cast<DWORD>(buffer.size()),
-                FALSE,
-                FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE,
-                nullptr,
-                &overlapped,
-                nullptr
-            );
-
-            if (!result) {
-                DWORD error = GetLastError();
-                if (error == ERROR_NOTIFY_ENUM_DIR) {
-                    // Buffer overflow - handle and continue
-                    if (config_.auto_grow_buffer) {
-                        size_t current_size = buffer.size();
-                        size_t new_size = std::min(current_size * 2, config_.max_buffer_size);
-                        if (new_size > current_size) {
-                            try {
-                                buffer.resize(new_size);
-                                impl_->current_buffer_size.store(new_size);
-                                if (config_.on_buffer_overflow) {
-                                    config_.on_buffer_overflow(current_size, new_size);
-                                }
-                            } catch (...) {}
+            // A request may still be outstanding after a debounce timeout
+            if (!read_pending) {
+                ResetEvent(overlapped.hEvent);
+
+                BOOL result = ReadDirectoryChangesW(
+                    impl_->dir_handle.get(),
+                    buffer.data(),
+                    static_cast<DWORD>(buffer.size()),
+                    FALSE,
+                    FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE,
+                    nullptr,
+                    &overlapped,
+                    nullptr
+                );
+
+                if (!result) {
+                    DWORD error = GetLastError();
+                    if (error == ERROR_NOTIFY_ENUM_DIR) {
+                        // Buffer overflow - handle and continue
+                        overflow_count_.fetch_add(1);
+                        if (config_.auto_grow_buffer) {
+                            size_t current_size = buffer.size();
+                            size_t new_size = std::min(current_size * 2, config_.max_buffer_size);
+                            if (new_size > current_size) {
+                                try {
+                                    buffer.resize(new_size);
+                                    impl_->current_buffer_size.store(new_size);
+                                    if (config_.on_buffer_overflow) {
+                                        config_.on_buffer_overflow(current_size, new_size);
+                                    }
+                                } catch (...) {}
+                            }
                         }
+                        continue;
                     }
-                    continue;
+                    break;
                 }
-                break;
+                read_pending = true;
+            }
+
+            DWORD timeout = INFINITE;
+            if (fire_at) {
+                auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+                    *fire_at - std::chrono::steady_clock::now());
+                timeout = static_cast<DWORD>(std::max<long long>(0, remaining.count()));
             }
 
             HANDLE handles[] = { overlapped.hEvent, impl_->stop_event.get() };
-            DWORD wait_result = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+            DWORD wait_result = WaitForMultipleObjects(2, handles, FALSE, timeout);
+
+            if (wait_result == WAIT_TIMEOUT) {
+                if (config_.trigger == TriggerPolicy::WriteComplete && !write_complete()) {
+                    fire_at = std::chrono::steady_clock::now() + config_.settle_interval;
+                    continue;
+                }
+                fire_at.reset();
+                notify_change();
+                continue;
+            }
 
             if (wait_result == WAIT_OBJECT_0) {
+                read_pending = false;
+                bool changed = false;
                 DWORD bytes_returned = 0;
                 if (GetOverlappedResult(impl_->dir_handle.get(), &overlapped, &bytes_returned, FALSE)) {
                     if (bytes_returned == 0) {
+                        changed = true;
+                    } else {
+                        auto* info = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(buffer.data());
+                        do {
+                            std::wstring_view changed_filename(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                            if (changed_filename == filename) {
+                                changed = true;
+                                break;
+                            }
+                            if (info->NextEntryOffset == 0) break;
+                            info = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(
+                                reinterpret_cast<BYTE*>(info) + info->NextEntryOffset
+                            );
+                        } while (true);
+                    }
+                }
+                if (changed) {
+                    if (config_.trigger == TriggerPolicy::AnyWrite && config_.debounce.count() == 0) {
                         notify_change();
-                        continue;
+                    } else {
+                        // Checked (and debounced) when the wait times out
+                        fire_at = std::chrono::steady_clock::now() + config_.debounce;
                     }
-                    
-                    auto* info = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(buffer.data());
-                    do {
-                        std::wstring changed_filename(info->FileName, info->FileNameLength / sizeof(WCHAR));
-                        if (changed_filename == filename) {
-                            notify_change();
-                            break;
-                        }
-                        if (info->NextEntryOffset == 0) break;
-                        info = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(
-                            reinterpret_cast<BYTE*>(info) + info->NextEntryOffset
-                        );
-                    } while (true);
                 }
             } else {
                 break;
@@ -4110,114 +7702,66 @@ inline void FileWatcher::stop_native() {
 
 #elif defined(__linux__)
 inline bool FileWatcher::start_native() {
-    UniqueFd inotify_fd(inotify_init1(IN_NONBLOCK));
-    if (!inotify_fd) {
-        return start_polling();
+    InotifySet* set = nullptr;
+    if (config_.external_loop) {
+        impl_->own_set = std::make_unique<InotifySet>();
+        if (!impl_->own_set->open()) {
+            impl_->own_set.reset();
+            return start_polling();
+        }
+        set = impl_->own_set.get();
+    } else {
+        auto* reactor = InotifyReactor::shared();
+        if (!reactor) {
+            return start_polling();
+        }
+        set = &reactor->set();
     }
 
-    impl_->dir_path = file_path_.parent_path();
-    if (impl_->dir_path.empty()) {
-        impl_->dir_path = ".";
+    auto dir_path = file_path_.parent_path();
+    if (dir_path.empty()) {
+        dir_path = ".";
     }
-    impl_->target_filename = file_path_.filename().string();
 
-    int dir_watch_fd = inotify_add_watch(
-        inotify_fd.get(),
-        impl_->dir_path.c_str(),
-        IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM
-    );
+    InotifySet::Options options;
+    options.debounce = config_.debounce;
+    options.trigger = config_.trigger;
+    options.settle_interval = config_.settle_interval;
+    options.follow_symlinks = config_.follow_symlinks;
+    options.on_resync = [this](uint32_t cause) {
+        if (cause & IN_Q_OVERFLOW) {
+            overflow_count_.fetch_add(1);
+        }
+        if (cause & IN_IGNORED) {
+            invalidation_count_.fetch_add(1);
+        }
+        if (config_.on_buffer_overflow) {
+            config_.on_buffer_overflow(0, 0);
+        }
+    };
 
-    if (dir_watch_fd < 0) {
-        return start_polling();
-    }
+    uint64_t subscription = set->subscribe(
+        dir_path, file_path_.filename().string(),
+        [this](uint32_t) { notify_change(); },
+        options);
 
-    int pipe_fds[2];
-    if (pipe(pipe_fds) < 0) {
-        inotify_rm_watch(inotify_fd.get(), dir_watch_fd);
+    if (subscription == 0) {
+        impl_->own_set.reset();
         return start_polling();
     }
 
-    impl_->inotify_fd = std::move(inotify_fd);
-    impl_->dir_watch_fd = dir_watch_fd;
-    impl_->pipe_read_fd.reset(pipe_fds[0]);
-    impl_->pipe_write_fd.reset(pipe_fds[1]);
-
-    watcher_thread_ = std::thread([this] {
-        constexpr size_t event_size = sizeof(struct inotify_event);
-        constexpr size_t buffer_size = 1024 * (event_size + NAME_MAX + 1);
-        std::vector<char> buffer(buffer_size);
-
-        struct pollfd fds[2];
-        fds[0].fd = impl_->inotify_fd.get();
-        fds[0].events = POLLIN;
-        fds[1].fd = impl_->pipe_read_fd.get();
-        fds[1].events = POLLIN;
-
-        while (running_.load()) {
-            int poll_result = poll(fds, 2, -1);
-            
-            if (poll_result < 0) {
-                if (errno == EINTR) continue;
-                break;
-            }
-
-            if (fds[1].revents & POLLIN) {
-                break;
-            }
-
-            if (fds[0].revents & POLLIN) {
-                ssize_t len = read(impl_->inotify_fd.get(), buffer.data(), buffer_size);
-                if (len < 0) {
-                    if (errno == EAGAIN || errno == EWOULDBLOCK) continue;
-                    break;
-                }
-                
-                if (len > 0) {
-                    size_t i = 0;
-                    bool should_notify = false;
-                    
-                    while (i < static_cast<size_t>(len)) {
-                        const auto* event = reinterpret_cast<const struct inotify_event*>(buffer.data() + i);
-                        
-                        if (event->len > 0) {
-                            std::string event_name(event->name);
-                            
-                            if (event_name == impl_->target_filename) {
-                                if (event->mask & (IN_MODIFY | IN_CLOSE_WRITE)) {
-                                    should_notify = true;
-                                }
-                                else if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
-                                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                                    should_notify = true;
-                                }
-                            }
-                        }
-                        
-                        i += sizeof(struct inotify_event) + event->len;
-                    }
-                    
-                    if (should_notify) {
-                        notify_change();
-                    }
-                }
-            }
-        }
-    });
+    impl_->set = set;
+    impl_->subscription = subscription;
     return true;
 }
 
 inline void FileWatcher::stop_native() {
-    if (impl_->pipe_write_fd) {
-        char c = 'x';
-        [[maybe_unused]] auto _ = write(impl_->pipe_write_fd.get(), &c, 1);
+    if (impl_->set && impl_->subscription != 0) {
+        impl_->set->unsubscribe(impl_->subscription);
     }
-    if (impl_->dir_watch_fd >= 0 && impl_->inotify_fd) {
-        inotify_rm_watch(impl_->inotify_fd.get(), impl_->dir_watch_fd);
-        impl_->dir_watch_fd = -1;
-    }
-    impl_->inotify_fd.reset();
-    impl_->pipe_read_fd.reset();
-    impl_->pipe_write_fd.reset();
+    impl_->set = nullptr;
+    impl_->subscription = 0;
+    impl_->own_set.reset();
 }
 
 #elif defined(__APPLE__)
@@ -4232,11 +7776,14 @@ namespace {
     ) {
         auto* watcher = static_cast<FileWatcher*>(info);
         auto** paths = static_cast<char**>(event_paths);
-        auto filename = watcher->get_file_path().filename().string();
+        const std::string& filename = watcher->get_file_path().filename().native();
 
+        // Compare the last path component in place
         for (size_t i = 0; i < num_events; ++i) {
-            std::filesystem::path event_path(paths[i]);
-            if (event_path.filename().string() == filename) {
+            std::string_view event_path(paths[i]);
+            if (event_path.size() > filename.size() &&
+                event_path.compare(event_path.size() - filename.size(), filename.size(), filename) == 0 &&
+                event_path[event_path.size() - filename.size() - 1] == '/') {
                 watcher->trigger_change();
                 break;
             }
@@ -4266,14 +7813,25 @@ inline bool FileWatcher::start_native() {
     FSEventStreamContext context{};
     context.info = this;
 
+    // With a debounce window, FSEvents coalesces for that long (trailing edge);
+    // otherwise the first event of a burst is delivered at once (NoDefer)
+    const bool debounce = config_.debounce.count() > 0;
+    const CFAbsoluteTime latency = debounce
+        ? std::chrono::duration<double>(config_.debounce).count()
+        : 0.1;
+    FSEventStreamCreateFlags flags = kFSEventStreamCreateFlagFileEvents;
+    if (!debounce) {
+        flags |= kFSEventStreamCreateFlagNoDefer;
+    }
+
     impl_->stream = FSEventStreamCreate(
         kCFAllocatorDefault,
         &fsevents_callback_impl,
         &context,
         paths,
         kFSEventStreamEventIdSinceNow,
-        0.1,
-        kFSEventStreamCreateFlagFileEvents | kFSEventStreamCreateFlagNoDefer
+        latency,
+        flags
     );
 
     CFRelease(paths);
@@ -4326,38 +7884,89 @@ inline Params::~Params() {
     stop_watching();
 }
 
-inline Params::Params(Params&& other) noexcept
+// Not noexcept: the moved-from object is left usable with a freshly allocated
+// empty snapshot and commit domain
+inline Params::Params(Params&& other)
     : mtx_()
     , file_path_(std::move(other.file_path_))
     , format_(other.format_)
     , file_cache_(std::move(other.file_cache_))
+    , change_detector_(std::move(other.change_detector_))
     , bindings_(std::move(other.bindings_))
-    , current_values_(std::move(other.current_values_))
+    , commit_domain_(std::exchange(other.commit_domain_, std::make_unique<internal::CommitDomain>()))
+    , snapshot_(other.snapshot_.release())
+    , key_slots_(std::move(other.key_slots_))
+    , slot_keys_(std::move(other.slot_keys_))
+    , changed_keys_(std::move(other.changed_keys_))
+    , full_apply_pending_(other.full_apply_pending_)
+    , pending_slots_(std::move(other.pending_slots_))
+    , pending_pos_(other.pending_pos_)
+    , slot_queued_(std::move(other.slot_queued_))
+    , apply_all_queued_(other.apply_all_queued_)
+    , notify_pending_(other.notify_pending_)
+    , apply_pending_(other.apply_pending_.load())
+    , content_hash_(other.content_hash_)
+    , skipped_parse_count_(other.skipped_parse_count_)
+    , bound_names_(std::make_unique<const std::vector<std::string>>())
+    , bound_names_dirty_(true)
     , file_watcher_(std::move(other.file_watcher_))
     , file_watcher_config_(std::move(other.file_watcher_config_))
     , file_read_retry_config_(std::move(other.file_read_retry_config_))
+    , file_reader_(std::move(other.file_reader_))
+    , read_retry_(other.read_retry_)
     , use_event_driven_(other.use_event_driven_)
     , file_changed_(other.file_changed_.load())
+    , watching_(other.watching_.load())
+    , background_parse_(other.background_parse_)
+    , parse_channel_(std::move(other.parse_channel_))
+    , parse_thread_(std::move(other.parse_thread_))
+    , parse_active_(other.parse_active_.exchange(false))
     , last_error_(std::move(other.last_error_))
     , on_change_callback_(std::move(other.on_change_callback_))
     , in_callback_(other.in_callback_.load())
 {
+    other.snapshot_.publish(std::make_unique<const internal::ValueSnapshot>());
+    other.bound_names_dirty_.store(true);
 }
 
-inline Params& Params::operator=(Params&& other) noexcept {
+inline Params& Params::operator=(Params&& other) {
     if (this != &other) {
         stop_watching();
         std::lock_guard<std::mutex> lock(mtx_);
         file_path_ = std::move(other.file_path_);
         format_ = other.format_;
         file_cache_ = std::move(other.file_cache_);
+        change_detector_ = std::move(other.change_detector_);
         bindings_ = std::move(other.bindings_);
-        current_values_ = std::move(other.current_values_);
+        commit_domain_ = std::exchange(other.commit_domain_, std::make_unique<internal::CommitDomain>());
+        snapshot_.publish(other.snapshot_.release());
+        key_slots_ = std::move(other.key_slots_);
+        slot_keys_ = std::move(other.slot_keys_);
+        changed_keys_ = std::move(other.changed_keys_);
+        full_apply_pending_ = other.full_apply_pending_;
+        pending_slots_ = std::move(other.pending_slots_);
+        pending_pos_ = other.pending_pos_;
+        slot_queued_ = std::move(other.slot_queued_);
+        apply_all_queued_ = other.apply_all_queued_;
+        notify_pending_ = other.notify_pending_;
+        apply_pending_.store(other.apply_pending_.load());
+        content_hash_ = other.content_hash_;
+        skipped_parse_count_ = other.skipped_parse_count_;
+        other.snapshot_.publish(std::make_unique<const internal::ValueSnapshot>());
+        bound_names_dirty_.store(true);
+        other.bound_names_dirty_.store(true);
         file_watcher_ = std::move(other.file_watcher_);
         file_watcher_config_ = std::move(other.file_watcher_config_);
         file_read_retry_config_ = std::move(other.file_read_retry_config_);
+        file_reader_ = std::move(other.file_reader_);
+        read_retry_ = other.read_retry_;
         use_event_driven_ = other.use_event_driven_;
         file_changed_.store(other.file_changed_.load());
+        watching_.store(other.watching_.load());
+        background_parse_ = other.background_parse_;
+        parse_channel_ = std::move(other.parse_channel_);
+        parse_thread_ = std::move(other.parse_thread_);
+        parse_active_.store(other.parse_active_.exchange(false));
         last_error_ = std::move(other.last_error_);
         on_change_callback_ = std::move(other.on_change_callback_);
         in_callback_.store(other.in_callback_.load());
@@ -4371,29 +7980,33 @@ inline LiveTuner::~LiveTuner() {
     }
 }
 
+// The watcher's callback refers to its owner, so it is not carried over by
+// moves; the destination starts its own on the next blocking read
 inline LiveTuner::LiveTuner(LiveTuner&& other) noexcept
     : mtx_()
     , input_file_path_(std::move(other.input_file_path_))
     , file_cache_(std::move(other.file_cache_))
-    , file_watcher_(std::move(other.file_watcher_))
+    , change_detector_(std::move(other.change_detector_))
     , file_watcher_config_(std::move(other.file_watcher_config_))
     , file_read_retry_config_(std::move(other.file_read_retry_config_))
+    , read_retry_(other.read_retry_)
     , use_event_driven_(other.use_event_driven_)
     , last_error_(std::move(other.last_error_))
 {
+    other.stop_watcher();
 }
 
 inline LiveTuner& LiveTuner::operator=(LiveTuner&& other) noexcept {
     if (this != &other) {
-        if (file_watcher_) {
-            file_watcher_->stop();
-        }
         std::lock_guard<std::mutex> lock(mtx_);
+        stop_watcher();
+        other.stop_watcher();
         input_file_path_ = std::move(other.input_file_path_);
         file_cache_ = std::move(other.file_cache_);
-        file_watcher_ = std::move(other.file_watcher_);
+        change_detector_ = std::move(other.change_detector_);
         file_watcher_config_ = std::move(other.file_watcher_config_);
         file_read_retry_config_ = std::move(other.file_read_retry_config_);
+        read_retry_ = other.read_retry_;
         use_event_driven_ = other.use_event_driven_;
         last_error_ = std::move(other.last_error_);
     }
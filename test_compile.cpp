@@ -12,7 +12,44 @@
 #include "include/LiveTuner.h"
 
 #include <iostream>
-#include <cassert>
+#include <cstdlib>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#endif
+
+// Unlike assert(), CHECK() still evaluates its argument under NDEBUG: many
+// checks below wrap calls with side effects (update(), wait_for_change(), ...)
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond << std::endl; \
+            std::abort(); \
+        } \
+    } while (0)
+
+// Polls until pred() holds; timing checks wait for an outcome, not a fixed sleep
+template <typename Pred>
+bool eventually(Pred pred, std::chrono::milliseconds timeout = std::chrono::milliseconds(3000)) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!pred() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return pred();
+}
+
+// Trivially copyable struct for SeqLocked<T> bindings ("x y z")
+struct TestVec3 {
+    float x = 0.0f, y = 0.0f, z = 0.0f;
+};
+
+std::istream& operator>>(std::istream& in, TestVec3& v) {
+    return in >> v.x >> v.y >> v.z;
+}
 
 int main() {
     std::cout << "=== LiveTuner Compilation Test ===" << std::endl;
@@ -38,12 +75,12 @@ int main() {
     // Test 2: ErrorInfo compiles and works
     {
         livetuner::ErrorInfo err;
-        assert(err.type == livetuner::ErrorType::None);
-        assert(!err);  // No error
+        CHECK(err.type == livetuner::ErrorType::None);
+        CHECK(!err);  // No error
         
         livetuner::ErrorInfo err2(livetuner::ErrorType::FileNotFound, "test.txt not found", "test.txt");
-        assert(err2.type == livetuner::ErrorType::FileNotFound);
-        assert(err2);  // Has error
+        CHECK(err2.type == livetuner::ErrorType::FileNotFound);
+        CHECK(err2);  // Has error
         
         std::cout << "[PASS] ErrorInfo works" << std::endl;
     }
@@ -78,6 +115,1156 @@ int main() {
         std::cout << "[PASS] FileFormat enum works" << std::endl;
     }
     
+    // Test 6: Params publishes values as lock-free snapshots
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_snapshot.ini").string();
+        {
+            std::ofstream out(path);
+            out << "speed = 2.5\nlives = 3\n";
+        }
+        
+        livetuner::Params params(path);
+        float speed = 0.0f;
+        params.bind("speed", speed, 1.0f);
+        CHECK(params.version() == 0);
+        CHECK(params.update());
+        CHECK(speed == 2.5f);
+        CHECK(params.version() == 1);
+        CHECK(params.get<int>("lives") == 3);
+        CHECK(params.has("speed") && !params.has("missing"));
+        CHECK(params.get_bound_names().size() == 1);
+        
+        std::atomic<bool> stop{false};
+        std::thread reader([&] {
+            while (!stop.load()) {
+                auto lives = params.get<int>("lives");
+                CHECK(!lives || *lives == 3 || *lives == 4);
+                (void)lives;
+            }
+        });
+        {
+            std::ofstream out(path);
+            out << "speed = 2.5\nlives = 4\n";
+        }
+        params.invalidate_cache();
+        params.update();
+        stop.store(true);
+        reader.join();
+        CHECK(params.get<int>("lives") == 4);
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Params snapshot reads" << std::endl;
+    }
+    
+    // Test 7: Values are converted once into typed slots
+    {
+        livetuner::internal::ParamValue num("42");
+        int i = 0;
+        double d = 0.0;
+        bool b = false;
+        unsigned char small = 0;
+        CHECK(livetuner::internal::convert_value(num, i) && i == 42);
+        CHECK(livetuner::internal::convert_value(num, d) && d == 42.0);
+        CHECK(!livetuner::internal::convert_value(num, b));
+        
+        livetuner::internal::ParamValue big("300");
+        short sh = 0;
+        CHECK(livetuner::internal::convert_value(big, sh) && sh == 300);
+        CHECK(!livetuner::internal::convert_value(big, small));  // char types keep stream semantics
+        
+        livetuner::internal::ParamValue quoted("\"Hero\"");
+        std::string s;
+        CHECK(livetuner::internal::convert_value(quoted, s) && s == "Hero");
+        CHECK(!livetuner::internal::convert_value(quoted, i));
+        
+        livetuner::internal::ParamValue flag("on");
+        CHECK(livetuner::internal::convert_value(flag, b) && b);
+        
+        // Unsigned values above INT64_MAX fall back to the text
+        livetuner::internal::ParamValue huge("18446744073709551615");
+        uint64_t u64 = 0;
+        CHECK(livetuner::internal::convert_value(huge, u64) && u64 == UINT64_MAX);
+        CHECK(!livetuner::internal::convert_value(huge, i));
+        {
+            auto path = std::filesystem::temp_directory_path() / "livetuner_test_uint64.ini";
+            std::ofstream(path) << "mask = 18446744073709551615\n";
+            livetuner::Params params(path.string());
+            uint64_t mask = 0;
+            params.bind("mask", mask);
+            CHECK(params.update() && mask == UINT64_MAX);
+            CHECK(params.get<uint64_t>("mask") == UINT64_MAX);
+            std::filesystem::remove(path);
+        }
+        
+        int parsed_int = 0;
+        double parsed_double = 0.0;
+        bool parsed_bool = false;
+        CHECK(livetuner::internal::parse_value(std::string(" +7 "), parsed_int) && parsed_int == 7);
+        CHECK(!livetuner::internal::parse_value(std::string("7x"), parsed_int));
+        CHECK(!livetuner::internal::parse_value(std::string("99999999999"), parsed_int));
+        CHECK(livetuner::internal::parse_value(std::string("-1.5e3"), parsed_double) && parsed_double == -1500.0);
+        CHECK(!livetuner::internal::parse_value(std::string("inf"), parsed_double));
+        CHECK(livetuner::internal::parse_value(std::string("TRUE"), parsed_bool) && parsed_bool);
+        CHECK(livetuner::internal::parse_value(std::string("Off"), parsed_bool) && !parsed_bool);
+        
+        std::cout << "[PASS] Typed value store" << std::endl;
+    }
+    
+    // Test 8: ParamHandle survives keys disappearing and coming back
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_handle.ini").string();
+        {
+            std::ofstream out(path);
+            out << "player.speed = 3\n";
+        }
+        
+        livetuner::Params params(path);
+        auto early = params.handle<int>("player.speed");
+        CHECK(early && !early.exists());
+        params.update();
+        CHECK(early.get() == 3);
+        auto late = params.handle<double>("player.speed");
+        CHECK(late.get_or(0.0) == 3.0);
+        
+        {
+            std::ofstream out(path);
+            out << "other = 1\n";
+        }
+        params.invalidate_cache();
+        params.update();
+        CHECK(!early.exists() && early.get_or(-1) == -1);
+        
+        {
+            std::ofstream out(path);
+            out << "player.speed = 5\n";
+        }
+        params.invalidate_cache();
+        params.update();
+        CHECK(early.get() == 5 && late.get() == 5.0);
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] ParamHandle" << std::endl;
+    }
+    
+    // Test 9: Missing files are negatively cached; watched files skip stat when idle
+    {
+        livetuner::Params missing("/nonexistent_livetuner_dir/params.ini");
+        CHECK(!missing.update());
+        CHECK(missing.last_error().type == livetuner::ErrorType::FileNotFound);
+        CHECK(!missing.update());
+        
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_watch.ini").string();
+        {
+            std::ofstream out(path);
+            out << "value = 1\n";
+        }
+        livetuner::Params params(path);
+        int value = 0;
+        params.bind("value", value);
+        params.start_watching();
+        CHECK(params.update() && value == 1);
+        CHECK(!params.update());
+        params.stop_watching();
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Idle update fast path" << std::endl;
+    }
+    
+    // Test 10: Bindings live in per-type segments; unbind keeps the rest intact
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_bindings.ini").string();
+        {
+            std::ofstream out(path);
+            out << "a = 1\nb = 2\nc = 3\nname = hero\nratio = 0.5\n";
+        }
+        
+        livetuner::Params params(path);
+        int a = 0, b = 0, c = 0;
+        std::string name;
+        float ratio = 0.0f;
+        params.bind("a", a, -1);
+        params.bind("b", b, -2);
+        params.bind("c", c, -3);
+        params.bind("name", name, std::string("nobody"));
+        params.bind("ratio", ratio, 1.0f);
+        params.unbind("a");
+        CHECK(params.get_bound_names().size() == 4);
+        
+        CHECK(params.update());
+        CHECK(a == -1 && b == 2 && c == 3 && name == "hero" && ratio == 0.5f);
+        
+        // Only the edited and removed keys are re-applied
+        b = 100;
+        {
+            std::ofstream out(path);
+            out << "a = 1\nb = 2\nc = 30\nname = hero\n";
+        }
+        params.invalidate_cache();
+        params.update();
+        CHECK(params.changed_keys() == (std::vector<std::string>{"a", "b", "c", "name"}));
+        b = 100;
+        {
+            std::ofstream out(path);
+            out << "a = 1\nb = 2\nc = 31\nname = hero\n";
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));  // Past the mtime cache window
+        params.update();
+        CHECK(params.changed_keys() == std::vector<std::string>{"c"});
+        CHECK(b == 100 && c == 31 && ratio == 1.0f);
+        
+        params.reset_to_defaults();
+        CHECK(b == -2 && c == -3 && name == "nobody" && ratio == 1.0f);
+        
+        
+        // A variable bound after a load gets the loaded value, and keeps it
+        // when only another key changes
+        {
+            std::ofstream out(path);
+            out << "a = 1\nb = 2\nc = 3\n";
+        }
+        livetuner::Params late(path);
+        int late_a = 0;
+        late.bind("a", late_a, -1);
+        bool loaded = late.update();
+        CHECK(loaded && late_a == 1);
+        int late_c = 0;
+        late.bind("c", late_c, -1);
+        CHECK(late_c == 3);
+        {
+            std::ofstream out(path);
+            out << "a = 10\nb = 2\nc = 3\n";
+        }
+        loaded = late.update();  // Size changed: seen without invalidate_cache()
+        CHECK(loaded && late_a == 10 && late_c == 3);
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Binding table" << std::endl;
+    }
+    
+    // Test 11: FileReader reuses its buffer; errors map to ErrorType
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_reader.txt").string();
+        {
+            std::ofstream out(path, std::ios::binary);
+            out << "first line\nsecond line\n";
+        }
+        livetuner::internal::FileReader reader;
+        livetuner::ErrorInfo error;
+        CHECK(reader.read(path, error));
+        CHECK(reader.view() == "first line\nsecond line\n");
+        {
+            std::ofstream out(path, std::ios::binary);
+            out << "short";
+        }
+        CHECK(reader.read(path, error));
+        CHECK(reader.view() == "short");
+        
+        std::filesystem::remove(path);
+        CHECK(!reader.read(path, error));
+        CHECK(error.type == livetuner::ErrorType::FileNotFound);
+        {
+            std::ofstream out(path, std::ios::binary);
+        }
+        CHECK(!reader.read(path, error));
+        CHECK(error.type == livetuner::ErrorType::FileEmpty);
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] File reader" << std::endl;
+    }
+    
+    // Test 12: Deferred read retries never sleep on the calling thread
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_deferred.ini").string();
+        {
+            std::ofstream out(path);  // Empty: reads fail until content arrives
+        }
+        livetuner::Params params(path);
+        livetuner::internal::FileReadRetryConfig retry;
+        retry.retry_delay = std::chrono::milliseconds(100);
+        retry.deferred = true;
+        params.set_read_retry_config(retry);
+        
+        auto start = std::chrono::steady_clock::now();
+        CHECK(!params.update());
+        CHECK(std::chrono::steady_clock::now() - start < retry.retry_delay);
+        {
+            std::ofstream out(path);
+            out << "speed = 4\n";
+        }
+        CHECK(!params.poll());  // Retry not due yet
+        std::this_thread::sleep_for(std::chrono::milliseconds(110));
+        CHECK(params.poll());
+        CHECK(params.get_or("speed", 0) == 4);
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Deferred read retry" << std::endl;
+    }
+    
+    // Test 13: Rewrites with identical bytes skip parsing
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_hash.ini").string();
+        auto write = [&](const char* text) {
+            std::ofstream out(path);
+            out << text;
+        };
+        write("speed = 4\n");
+        livetuner::Params params(path);
+        CHECK(params.update());
+        
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));  // Past the mtime cache window
+        write("speed = 4\n");
+        params.invalidate_cache();  // Drops the hash too: this reload must parse
+        CHECK(params.update());
+        CHECK(params.skipped_parse_count() == 0);
+        
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        write("speed = 4\n");
+        CHECK(!params.update());
+        CHECK(params.skipped_parse_count() == 1);
+        
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        write("speed = 5\n");
+        CHECK(params.update());
+        CHECK(params.get_or("speed", 0) == 5);
+        CHECK(params.skipped_parse_count() == 1);
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Content hash skip" << std::endl;
+    }
+    
+    // Test 14: Watchers share one inotify instance and thread; dispatch by filename
+    {
+        auto dir = std::filesystem::temp_directory_path();
+        auto path_a = (dir / "livetuner_test_shared_a.ini").string();
+        auto path_b = (dir / "livetuner_test_shared_b.ini").string();
+        auto write = [](const std::string& path, const char* text) {
+            std::ofstream out(path);
+            out << text;
+        };
+        write(path_a, "a = 1\n");
+        write(path_b, "b = 1\n");
+        
+#ifdef __linux__
+        auto thread_count = [] {
+            size_t count = 0;
+            for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator("/proc/self/task")) {
+                ++count;
+            }
+            return count;
+        };
+        livetuner::internal::FileWatcher warm_up;  // Starts the shared reactor thread
+        warm_up.start(path_a, [] {});
+        const size_t threads_before = thread_count();
+#endif
+        std::vector<std::unique_ptr<livetuner::internal::FileWatcher>> watchers_a;
+        for (int i = 0; i < 8; ++i) {
+            watchers_a.push_back(std::make_unique<livetuner::internal::FileWatcher>());
+            CHECK(watchers_a.back()->start(path_a, [] {}));
+        }
+        livetuner::internal::FileWatcher watcher_b;
+        CHECK(watcher_b.start(path_b, [] {}));
+#ifdef __linux__
+        CHECK(thread_count() == threads_before);
+#endif
+        
+        write(path_a, "a = 2\n");
+        for (auto& watcher : watchers_a) {
+            CHECK(watcher->wait_for_change(std::chrono::milliseconds(2000)));
+        }
+        CHECK(!watcher_b.wait_for_change(std::chrono::milliseconds(50)));
+        
+        watchers_a.clear();  // Unsubscribes; the directory watch stays for b
+        write(path_b, "b = 2\n");
+        CHECK(watcher_b.wait_for_change(std::chrono::milliseconds(2000)));
+        watcher_b.stop();
+        
+        std::filesystem::remove(path_a);
+        std::filesystem::remove(path_b);
+        std::cout << "[PASS] Shared watcher reactor" << std::endl;
+    }
+    
+    // Test 15: A burst of writes inside the debounce window is reported once
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_debounce.ini").string();
+        auto write = [&](int value) {
+            std::ofstream out(path);
+            out << "value = " << value << "\n";
+        };
+        write(0);
+        
+        livetuner::internal::FileWatcherConfig config;
+        config.debounce = std::chrono::milliseconds(100);
+        livetuner::internal::FileWatcher watcher(config);
+        std::atomic<int> notifications{0};
+        CHECK(watcher.start(path, [&] { ++notifications; }));
+        
+        // Exact counts only hold if the scheduler kept every gap inside the window
+        auto last_write = std::chrono::steady_clock::now();
+        auto longest_gap = std::chrono::steady_clock::duration::zero();
+        for (int i = 1; i <= 5; ++i) {
+            write(i);
+            auto now = std::chrono::steady_clock::now();
+            longest_gap = std::max(longest_gap, now - last_write);
+            last_write = now;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        const bool one_burst = std::max(longest_gap, std::chrono::steady_clock::now() - last_write) <
+                               config.debounce;
+        if (one_burst) {
+            CHECK(notifications == 0);  // Still inside the window
+        }
+        CHECK(eventually([&] { return notifications >= 1; }));
+        uint64_t seen = watcher.change_generation();
+        CHECK(!watcher.wait_for_change(seen, 2 * config.debounce));  // Nothing trails the report
+        CHECK(!one_burst || notifications == 1);
+        watcher.stop();
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Debounced change events" << std::endl;
+    }
+    
+    // Test 16: WriteComplete reports each save once, after the writer is done
+    {
+        auto dir = std::filesystem::temp_directory_path();
+        auto path = (dir / "livetuner_test_trigger.ini").string();
+        {
+            std::ofstream out(path);
+            out << "value = 0\n";
+        }
+        
+        livetuner::internal::FileWatcherConfig config;  // Default: TriggerPolicy::WriteComplete
+        livetuner::internal::FileWatcher watcher(config);
+        std::atomic<int> notifications{0};
+        CHECK(watcher.start(path, [&] { ++notifications; }));
+        
+        // Waits for the report, then checks that no second one follows
+        auto reported = [&](int expected) {
+            if (!eventually([&] { return notifications >= expected; })) {
+                return false;
+            }
+            uint64_t seen = watcher.change_generation();
+            return !watcher.wait_for_change(seen, 2 * config.settle_interval) &&
+                   notifications == expected;
+        };
+        
+        // Chunked save: several writes, then close. A gap longer than the
+        // settle interval is a legitimate report of its own
+        bool irregular = false;
+        {
+            std::ofstream out(path);
+            auto last_write = std::chrono::steady_clock::now();
+            auto longest_gap = std::chrono::steady_clock::duration::zero();
+            for (int i = 0; i < 3; ++i) {
+                out << "value = " << i << "\n" << std::flush;
+                auto now = std::chrono::steady_clock::now();
+                longest_gap = std::max(longest_gap, now - last_write);
+                last_write = now;
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            if (std::max(longest_gap, std::chrono::steady_clock::now() - last_write) <
+                config.settle_interval) {
+                CHECK(notifications == 0);  // Not complete while the writer is active
+            } else {
+                irregular = true;
+            }
+        }
+        if (irregular) {
+            CHECK(eventually([&] { return notifications >= 1; }));
+            uint64_t seen = watcher.change_generation();
+            for (int i = 0; i < 10 && watcher.wait_for_change(seen, 2 * config.settle_interval); ++i) {
+            }
+        } else {
+            CHECK(reported(1));
+        }
+        const int base = notifications;
+        
+        // Atomic save: write a temporary file, rename it into place
+        auto temp = (dir / "livetuner_test_trigger.ini.tmp").string();
+        {
+            std::ofstream out(temp);
+            out << "value = 7\n";
+        }
+        std::filesystem::rename(temp, path);
+        CHECK(reported(base + 1));
+        
+        // Writer that keeps the file open: reported once size/mtime settle
+        {
+            std::ofstream out(path, std::ios::app);
+            out << "extra = 1\n" << std::flush;
+            CHECK(reported(base + 2));  // Once, although the writer is still open
+        }
+        watcher.stop();
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Write-complete trigger" << std::endl;
+    }
+    
+#ifdef __linux__
+    // Test 17: Thread-less watching driven by the caller's own poll loop
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_external.ini").string();
+        {
+            std::ofstream out(path);
+            out << "value = 1\n";
+        }
+        auto thread_count = [] {
+            size_t count = 0;
+            for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator("/proc/self/task")) {
+                ++count;
+            }
+            return count;
+        };
+        
+        livetuner::Params params(path);
+        int value = 0;
+        params.bind("value", value);
+        auto config = params.get_watcher_config();
+        config.external_loop = true;
+        params.set_watcher_config(config);
+        
+        const size_t threads_before = thread_count();
+        params.start_watching();
+        CHECK(thread_count() == threads_before);
+        CHECK(params.event_fd() >= 0);
+        CHECK(params.process_events() && value == 1);  // Initial load
+        
+        {
+            std::ofstream out(path);
+            out << "value = 2\n";
+        }
+        struct pollfd fds[1] = {{params.event_fd(), POLLIN, 0}};
+        CHECK(::poll(fds, 1, 2000) == 1);
+        CHECK(params.process_events() && value == 2);
+        CHECK(!params.process_events());
+        
+        params.stop_watching();
+        CHECK(params.event_fd() == -1);
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Thread-less watching" << std::endl;
+    }
+#endif
+    
+    // Test 18: Blocking reads share one watcher and wake on its change generation
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_blocking.txt").string();
+        {
+            std::ofstream out(path);
+            out << "# no value yet\n";
+        }
+        livetuner::LiveTuner tuner(path);
+        int value = 0;
+        CHECK(!tuner.get_timeout(value, std::chrono::milliseconds(50)));
+        
+        std::thread writer([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            std::ofstream out(path);
+            out << "42\n";
+        });
+        auto start = std::chrono::steady_clock::now();
+        CHECK(tuner.get_timeout(value, std::chrono::milliseconds(5000)));
+        CHECK(value == 42);
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(2000));
+        writer.join();
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Persistent watcher for blocking reads" << std::endl;
+    }
+    
+    // Test 19: Every waiter sees every change (generation counter)
+    {
+        auto path = (std::filesystem::temp_directory_path() / "livetuner_test_generation.ini").string();
+        {
+            std::ofstream out(path);
+            out << "value = 0\n";
+        }
+        livetuner::internal::FileWatcher watcher;
+        CHECK(watcher.start(path, [] {}));
+        
+        const uint64_t start_generation = watcher.change_generation();
+        std::atomic<int> woken{0};
+        std::atomic<int> ready{0};
+        std::vector<std::thread> waiters;
+        for (int i = 0; i < 3; ++i) {
+            waiters.emplace_back([&] {
+                uint64_t seen = start_generation;
+                ++ready;
+                if (watcher.wait_for_change(seen, std::chrono::milliseconds(3000)) && seen > start_generation) {
+                    ++woken;
+                }
+            });
+        }
+        while (ready < 3) {
+            std::this_thread::yield();
+        }
+        {
+            std::ofstream out(path);
+            out << "value = 1\n";
+        }
+        for (auto& waiter : waiters) {
+            waiter.join();
+        }
+        CHECK(woken == 3);
+        
+        uint64_t seen = watcher.change_generation();
+        CHECK(!watcher.wait_for_change(seen, std::chrono::milliseconds(20)));
+        watcher.stop();
+        CHECK(!watcher.wait_for_change(seen, std::chrono::milliseconds(1000)));  // Returns at once when stopped
+        
+        std::filesystem::remove(path);
+        std::cout << "[PASS] Multi-waiter change generation" << std::endl;
+    }
+    
+#ifdef __linux__
+    // Test 20: Resync after inotify queue overflow and a dropped watch
+    {
+        auto dir = std::filesystem::temp_directory_path() / "livetuner_test_resync";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        auto path = (dir / "params.ini").string();
+        {
+            std::ofstream out(path);
+            out << "value = 0\n";
+        }
+        
+        std::atomic<int> overflow_callbacks{0};
+        livetuner::internal::FileWatcherConfig config;
+        config.external_loop = true;
+        config.on_buffer_overflow = [&](size_t, size_t) { ++overflow_callbacks; };
+        livetuner::internal::FileWatcher watcher(config);
+        std::atomic<int> changes{0};
+        CHECK(watcher.start(path, [&] { ++changes; }));
+        
+        size_t max_queued = 16384;
+        std::ifstream("/proc/sys/fs/inotify/max_queued_events") >> max_queued;
+        if (max_queued <= 100000) {
+            // Alternate two files so the kernel cannot coalesce the events
+            std::ofstream a(dir / "noise_a.log"), b(dir / "noise_b.log");
+            for (size_t i = 0; i < max_queued; ++i) {
+                (i % 2 ? a : b) << "x" << std::flush;
+            }
+            {
+                std::ofstream out(path);
+                out << "value = 1\n";  // Its events do not fit in the queue
+            }
+            CHECK(watcher.process_events());
+            CHECK(changes == 1);
+            CHECK(watcher.overflow_count() == 1);
+            CHECK(overflow_callbacks == 1);
+        }
+        
+        // Removing the directory drops the watch; it is re-armed once the directory is back
+        std::filesystem::remove_all(dir);
+        watcher.process_events();
+        CHECK(watcher.invalidation_count() == 1);
+        const int changes_before = changes;
+        std::filesystem::create_directories(dir);
+        {
+            std::ofstream out(path);
+            out << "value = 2\n";
+        }
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+        while (changes == changes_before && std::chrono::steady_clock::now() < deadline) {
+            struct pollfd pfd{watcher.event_fd(), POLLIN, 0};
+            ::poll(&pfd, 1, watcher.next_timeout());
+            watcher.process_events();
+        }
+        CHECK(changes == changes_before + 1);
+        
+        // Watching again: later writes are reported by events
+        {
+            std::ofstream out(path);
+            out << "value = 3\n";
+        }
+        CHECK(watcher.process_events());
+        CHECK(changes == changes_before + 2);
+        
+        watcher.stop();
+        std::filesystem::remove_all(dir);
+        std::cout << "[PASS] Overflow and dropped-watch resync" << std::endl;
+    }
+    
+    // Test 21: Symlink chain swapped atomically (ConfigMap layout)
+    {
+        namespace fs = std::filesystem;
+        auto dir = fs::temp_directory_path() / "livetuner_test_symlink";
+        fs::remove_all(dir);
+        auto publish = [&](const std::string& version, int value) {
+            fs::create_directories(dir / version);
+            std::ofstream(dir / version / "params.ini") << "value = " << value << "\n";
+            fs::create_directory_symlink(version, dir / "..data_tmp");
+            fs::rename(dir / "..data_tmp", dir / "..data");  // Atomic swap
+        };
+        publish("..v1", 1);
+        fs::create_symlink("..data/params.ini", dir / "params.ini");
+        
+        livetuner::internal::FileWatcherConfig config;
+        config.external_loop = true;
+        config.follow_symlinks = true;
+        livetuner::internal::FileWatcher watcher(config);
+        std::atomic<int> changes{0};
+        CHECK(watcher.start((dir / "params.ini").string(), [&] { ++changes; }));
+        
+        auto drain = [&] {
+            auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+            while (std::chrono::steady_clock::now() < until) {
+                struct pollfd pfd{watcher.event_fd(), POLLIN, 0};
+                ::poll(&pfd, 1, 20);
+                watcher.process_events();
+            }
+        };
+        
+        publish("..v2", 2);
+        fs::remove_all(dir / "..v1");
+        drain();
+        CHECK(changes == 1);  // Exactly one per swap
+        
+        std::ofstream(dir / "..v2" / "params.ini") << "value = 3\n";  // The new target is watched
+        drain();
+        CHECK(changes == 2);
+        
+        publish("..v3", 4);
+        fs::remove_all(dir / "..v2");
+        drain();
+        CHECK(changes == 3);
+        
+        watcher.stop();
+        fs::remove_all(dir);
+        std::cout << "[PASS] Symlink chain follow" << std::endl;
+    }
+#endif
+    
+    // Test 22: One polling thread for every polled file
+    {
+        namespace fs = std::filesystem;
+        auto dir = fs::temp_directory_path() / "livetuner_test_polling";
+        fs::remove_all(dir);
+        fs::create_directories(dir);
+        auto& scheduler = livetuner::internal::PollScheduler::shared();
+        
+#ifdef __linux__
+        auto thread_count = [] {
+            size_t count = 0;
+            for ([[maybe_unused]] const auto& entry : fs::directory_iterator("/proc/self/task")) {
+                ++count;
+            }
+            return count;
+        };
+        const size_t threads_before = thread_count();
+#endif
+        constexpr int file_count = 32;
+        std::atomic<int> fired[file_count] = {};
+        std::vector<uint64_t> ids;
+        for (int i = 0; i < file_count; ++i) {
+            auto path = dir / ("file" + std::to_string(i) + ".ini");
+            std::ofstream(path) << "value = 0\n";
+            ids.push_back(scheduler.subscribe(path, std::chrono::milliseconds(30), [&fired, i] { ++fired[i]; }));
+        }
+#ifdef __linux__
+        CHECK(thread_count() == threads_before);
+#endif
+        
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));  // Distinct mtime
+        std::ofstream(dir / "file7.ini") << "value = 12345\n";
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+        while (fired[7] == 0 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(150));
+        for (int i = 0; i < file_count; ++i) {
+            CHECK(fired[i] == (i == 7 ? 1 : 0));
+        }
+        
+        for (auto id : ids) {
+            scheduler.unsubscribe(id);
+        }
+        CHECK(scheduler.size() == 0);
+        
+        // A callback blocked on an application lock does not stall unsubscribing others
+        std::mutex app_mutex;
+        std::atomic<bool> entered{false};
+        auto blocked = scheduler.subscribe(dir / "file0.ini", std::chrono::milliseconds(0), [&] {
+            entered = true;
+            std::lock_guard<std::mutex> lock(app_mutex);
+        });
+        auto other = scheduler.subscribe(dir / "file1.ini", std::chrono::milliseconds(0), [] {});
+        {
+            std::unique_lock<std::mutex> lock(app_mutex);
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));  // Distinct mtime
+            std::ofstream(dir / "file0.ini") << "value = 1\n";
+            deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+            while (!entered && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            CHECK(entered);
+            auto removed = std::async(std::launch::async, [&] { scheduler.unsubscribe(other); });
+            CHECK(removed.wait_for(std::chrono::seconds(2)) == std::future_status::ready);
+        }
+        scheduler.unsubscribe(blocked);
+        fs::remove_all(dir);
+        std::cout << "[PASS] Shared polling scheduler" << std::endl;
+    }
+    
+    // Test 23: Held-descriptor change detection
+    {
+        namespace fs = std::filesystem;
+        using Change = livetuner::internal::FileChangeDetector::Result;
+        auto path = fs::temp_directory_path() / "livetuner_test_detector.ini";
+        std::ofstream(path) << "value = 1\n";
+        
+        livetuner::internal::FileChangeDetector detector;
+        CHECK(detector.check(path) == Change::Changed);
+        auto start = std::chrono::steady_clock::now();
+        auto again = detector.check(path);
+        if (std::chrono::steady_clock::now() - start < livetuner::internal::FileChangeDetector::racy_recheck_interval) {
+            CHECK(again == Change::Unchanged);
+        }
+        
+        // Same size, possibly the same timestamp tick: still seen (racy stamp)
+        std::ofstream(path) << "value = 2\n";
+        std::this_thread::sleep_for(std::chrono::milliseconds(15));
+        CHECK(detector.check(path) == Change::Changed);
+        
+        // Atomic rename-over save: the held file is unlinked, the new one is opened
+        auto temp = fs::temp_directory_path() / "livetuner_test_detector.tmp";
+        std::ofstream(temp) << "value = 3\n";
+        fs::rename(temp, path);
+        CHECK(detector.check(path) == Change::Changed);
+        
+        fs::remove(path);
+        CHECK(detector.check(path) == Change::Missing);
+        
+        // Params sees both of two quick same-size saves
+        std::ofstream(path) << "value = 1\n";
+        livetuner::Params params(path.string());
+        int value = 0;
+        params.bind("value", value);
+        CHECK(params.update() && value == 1);
+        std::ofstream(path) << "value = 2\n";
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+        while (value != 2 && std::chrono::steady_clock::now() < deadline) {
+            params.update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        CHECK(value == 2);
+        
+        fs::remove(path);
+        std::cout << "[PASS] Held-descriptor change detection" << std::endl;
+    }
+    
+    // Test 24: Background parse, commit on the polling thread
+    {
+        namespace fs = std::filesystem;
+        auto path = fs::temp_directory_path() / "livetuner_test_background.ini";
+        std::ofstream(path) << "speed = 1.5\ncount = 3\n";
+        
+        livetuner::Params params(path.string());
+        params.set_background_parse(true);
+        float speed = 0.0f;
+        int count = 0;
+        params.bind("speed", speed);
+        params.bind("count", count);
+        std::thread::id callback_thread;
+        int callbacks = 0;
+        params.on_change([&] {
+            callback_thread = std::this_thread::get_id();
+            ++callbacks;
+        });
+        params.start_watching();
+        
+        auto poll_until = [&params](auto done) {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+            while (!done() && std::chrono::steady_clock::now() < deadline) {
+                params.poll();
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            return done();
+        };
+        CHECK(poll_until([&] { return count == 3; }));
+        CHECK(speed == 1.5f);
+        CHECK(callback_thread == std::this_thread::get_id());
+        
+        std::ofstream(path) << "speed = 1.5\ncount = 7\n";
+        CHECK(poll_until([&] { return count == 7; }));
+        CHECK(params.changed_keys() == std::vector<std::string>{"count"});
+        CHECK(callbacks == 2 && callback_thread == std::this_thread::get_id());
+        
+        params.stop_watching();
+        
+        // update() commits prepared loads too, and set_file() moves the worker
+        auto other = fs::temp_directory_path() / "livetuner_test_background_other.ini";
+        std::ofstream(other) << "speed = 4.5\ncount = 40\n";
+        std::ofstream(path) << "speed = 2.5\ncount = 11\n";
+        livetuner::Params updated(path.string());
+        updated.set_background_parse(true);
+        int value = -1;
+        updated.bind("count", value, -1);
+        updated.start_watching();
+        auto update_until = [&updated](auto done) {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+            while (!done() && std::chrono::steady_clock::now() < deadline) {
+                updated.update();
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            return done();
+        };
+        CHECK(update_until([&] { return value == 11; }));
+        std::ofstream(path) << "speed = 2.5\ncount = 12\n";
+        CHECK(update_until([&] { return value == 12; }));
+        updated.set_file(other.string());
+        CHECK(update_until([&] { return value == 40; }));
+        std::ofstream(other) << "speed = 4.5\ncount = 41\n";
+        CHECK(update_until([&] { return value == 41; }));
+        updated.stop_watching();
+        
+        // stop_watching() may release the worker while another thread polls
+        std::atomic<bool> polling{true};
+        std::thread poller([&] {
+            while (polling.load()) {
+                updated.update();
+            }
+        });
+        for (int i = 0; i < 20; ++i) {
+            updated.start_watching();
+            updated.stop_watching();
+        }
+        polling.store(false);
+        poller.join();
+        
+        fs::remove(other);
+        fs::remove(path);
+        std::cout << "[PASS] Background parse" << std::endl;
+    }
+    
+    // Test 25: Budgeted poll assigns bindings across calls
+    {
+        namespace fs = std::filesystem;
+        auto path = fs::temp_directory_path() / "livetuner_test_budget.ini";
+        constexpr int count = 1000;
+        auto write_all = [&path](int value) {
+            std::ofstream out(path);
+            for (int i = 0; i < count; ++i) {
+                out << "p" << i << " = " << value << "\n";
+            }
+        };
+        write_all(1);
+        
+        livetuner::Params params(path.string());
+        std::vector<int> values(count, 0);
+        for (int i = 0; i < count; ++i) {
+            params.bind("p" + std::to_string(i), values[i]);
+        }
+        int callbacks = 0;
+        params.on_change([&] { ++callbacks; });
+        params.start_watching();
+        
+        // A zero budget still makes progress, one batch per call
+        auto first = params.poll(std::chrono::microseconds(0));
+        CHECK(!first.updated && first.applied == livetuner::Params::bind_batch_size);
+        CHECK(first.pending == count - livetuner::Params::bind_batch_size);
+        CHECK(params.pending_bindings() == first.pending);
+        CHECK(params.get_or<int>("p999", 0) == 1);  // Published at once
+        CHECK(callbacks == 0);
+        
+        size_t calls = 1;
+        livetuner::Params::PollProgress progress = first;
+        while (!progress.updated) {
+            progress = params.poll(std::chrono::microseconds(0));
+            ++calls;
+        }
+        CHECK(progress.pending == 0 && calls > 1);
+        CHECK(callbacks == 1);
+        for (int v : values) {
+            CHECK(v == 1);
+        }
+        
+        // update() finishes what a budgeted poll left
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        write_all(2);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+        while (params.get_or<int>("p0", 0) != 2 && std::chrono::steady_clock::now() < deadline) {
+            params.poll(std::chrono::microseconds(0));
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        CHECK(params.get_or<int>("p0", 0) == 2);
+        CHECK(params.update() && params.pending_bindings() == 0);
+        CHECK(callbacks == 2 && values.front() == 2 && values.back() == 2);
+        
+        params.stop_watching();
+        fs::remove(path);
+        std::cout << "[PASS] Budgeted poll" << std::endl;
+    }
+    
+    // Test 26: Double-buffered bindings become visible at commit()
+    {
+        namespace fs = std::filesystem;
+        auto path = fs::temp_directory_path() / "livetuner_test_buffered.ini";
+        std::ofstream(path) << "level = 1\nname = v1\n";
+        
+        livetuner::Params params(path.string());
+        livetuner::Buffered<int> level;
+        livetuner::Buffered<std::string> name;
+        params.bind("level", level, 0);
+        params.bind("name", name, std::string("v0"));
+        CHECK(params.commit() && level.get() == 0 && name.get() == "v0");
+        
+        CHECK(params.update());
+        CHECK(level.staged() == 1 && level.get() == 0);  // Staged, not yet visible
+        CHECK(params.commit() && level.get() == 1 && name.get() == "v1");
+        CHECK(!params.commit());  // Nothing staged
+        
+        // Readers on another thread always see a pair from one commit
+        std::atomic<bool> done{false};
+        std::atomic<int> torn{0};
+        std::atomic<int> reads{0};
+        std::thread reader([&] {
+            while (!done.load()) {
+                auto frame = params.frame();
+                if (name.get(frame) != "v" + std::to_string(level.get(frame))) {
+                    ++torn;
+                }
+                ++reads;
+            }
+        });
+        for (int i = 2; i <= 20; ++i) {
+            std::ofstream(path) << "level = " << i << "\nname = v" << i << "\n";
+            params.invalidate_cache();
+            CHECK(params.update());
+            params.commit();
+        }
+        while (reads.load() < 100) {
+            std::this_thread::yield();
+        }
+        done = true;
+        reader.join();
+        CHECK(torn.load() == 0);
+        CHECK(level.get() == 20 && name.get() == "v20");
+        
+        // A reload partly applied by poll(budget) is not committed
+        std::vector<std::unique_ptr<livetuner::Buffered<int>>> many;
+        {
+            std::ofstream out(path);
+            out << "level = 21\nname = v21\n";
+            for (int i = 0; i < 200; ++i) {
+                out << "b" << i << " = 1\n";
+            }
+        }
+        for (int i = 0; i < 200; ++i) {
+            many.push_back(std::make_unique<livetuner::Buffered<int>>());
+            params.bind("b" + std::to_string(i), *many.back(), 0);
+        }
+        params.commit();
+        params.invalidate_cache();
+        params.start_watching();
+        auto progress = params.poll(std::chrono::microseconds(0));
+        CHECK(progress.pending > 0);
+        CHECK(!params.commit());
+        while (progress.pending > 0) {
+            progress = params.poll(std::chrono::microseconds(0));
+        }
+        params.stop_watching();
+        CHECK(params.commit());
+        for (const auto& b : many) {
+            CHECK(b->get() == 1);
+        }
+        
+        fs::remove(path);
+        std::cout << "[PASS] Double-buffered bindings" << std::endl;
+    }
+    
+    // Test 27: Atomic and seqlock-published bindings
+    {
+        namespace fs = std::filesystem;
+        auto path = fs::temp_directory_path() / "livetuner_test_atomic.ini";
+        std::ofstream(path) << "count = 5\nratio = 0.25\nenabled = true\nposition = 1 1 1\n";
+        
+        livetuner::Params params(path.string());
+        std::atomic<int> count{0};
+        std::atomic<float> ratio{0.0f};
+        std::atomic<bool> enabled{false};
+        livetuner::SeqLocked<TestVec3> position;
+        params.bind("count", count, 1);
+        params.bind("ratio", ratio, 0.5f);
+        params.bind("enabled", enabled);
+        params.bind("position", position);
+        CHECK(count.load() == 1 && ratio.load() == 0.5f);
+        
+        CHECK(params.update());
+        CHECK(count.load(std::memory_order_acquire) == 5);
+        CHECK(ratio.load() == 0.25f && enabled.load());
+        TestVec3 p = position.load();
+        CHECK(p.x == 1.0f && p.y == 1.0f && p.z == 1.0f);
+        
+        // A reader never sees a partially stored struct
+        std::atomic<bool> done{false};
+        std::atomic<int> torn{0};
+        std::atomic<int> reads{0};
+        std::thread reader([&] {
+            while (!done.load()) {
+                TestVec3 v = position.load();
+                if (v.x != v.y || v.y != v.z) {
+                    ++torn;
+                }
+                ++reads;
+            }
+        });
+        for (int i = 2; i <= 20; ++i) {
+            std::ofstream(path) << "count = " << i << "\nratio = 0.25\nenabled = true\nposition = "
+                                << i << " " << i << " " << i << "\n";
+            params.invalidate_cache();
+            CHECK(params.update());
+        }
+        while (reads.load() < 100) {
+            std::this_thread::yield();
+        }
+        done = true;
+        reader.join();
+        CHECK(torn.load() == 0);
+        CHECK(count.load() == 20 && position.load().z == 20.0f);
+        
+        fs::remove(path);
+        std::cout << "[PASS] Atomic and seqlock bindings" << std::endl;
+    }
+    
+#ifdef __linux__
+    // Test 28: A blocked callback does not stall stopping other watchers
+    {
+        namespace fs = std::filesystem;
+        auto path_a = fs::temp_directory_path() / "livetuner_test_blocked_a.ini";
+        auto path_b = fs::temp_directory_path() / "livetuner_test_blocked_b.ini";
+        std::ofstream(path_a) << "a = 1\n";
+        std::ofstream(path_b) << "b = 1\n";
+        
+        std::mutex app_mutex;
+        std::atomic<bool> entered{false};
+        livetuner::internal::FileWatcher watcher_a;
+        livetuner::internal::FileWatcher watcher_b;
+        CHECK(watcher_a.start(path_a, [&] {
+            entered = true;
+            std::lock_guard<std::mutex> lock(app_mutex);
+        }));
+        CHECK(watcher_b.start(path_b, [] {}));
+        
+        {
+            std::unique_lock<std::mutex> lock(app_mutex);
+            std::ofstream(path_a) << "a = 2\n";
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+            while (!entered && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            CHECK(entered);
+            
+            // The reactor thread is blocked in a's callback on app_mutex
+            auto stopped = std::async(std::launch::async, [&] { watcher_b.stop(); });
+            CHECK(stopped.wait_for(std::chrono::seconds(2)) == std::future_status::ready);
+        }
+        watcher_a.stop();
+        
+        fs::remove(path_a);
+        fs::remove(path_b);
+        std::cout << "[PASS] Callbacks run outside the shared lock" << std::endl;
+    }
+#endif
+    
     std::cout << std::endl;
     std::cout << "=== All Compilation Tests Passed ===" << std::endl;
     